@@ -14,7 +14,7 @@ def main():
     #convert_model("sbml/fixed_BCR_sbml_pSSAlib.xml", "bipsim_models/bcr", "test_cases/bcr.csv")
     #convert_model("sbml/fceri_gamma2_sbml_pSSAlib.xml", "bipsim_models/fceri", "test_cases/fceri.csv")
     
-def convert_model(input_file, model_dir, tc_file, algorithms = ["tree", "hybrid", "vector"]):    
+def convert_model(input_file, model_dir, tc_file, algorithms = ["tree", "ktree", "hybrid", "vector", "sorting"]):    
     test_cases = pd.read_csv(tc_file)
     ic_species = list(test_cases.columns[5:])
     model = sbml_to_bipsim.SbmlData(input_file)
@@ -13,7 +13,7 @@ def main():
     #run_models("bcr")
     #run_models("fceri")
 
-def run_models(model_name, algorithms = ["tree", "hybrid", "vector"]):
+def run_models(model_name, algorithms = ["tree", "ktree", "hybrid", "vector", "sorting"]):
     model_dir = os.path.join("bipsim_models", model_name)
     tc_file = os.path.join("test_cases", model_name + ".csv")
     test_cases = pd.read_csv(tc_file)
@@ -16,7 +16,7 @@ def main():
         method = "nf"
         os.makedirs(case.bionetgen_directory(method), exist_ok=True)
         n_cascade.to_bionetgen(case.bionetgen_directory(method), method, False)
-        for method in ["vector", "tree", "hybrid"]:
+        for method in ["vector", "sorting", "tree", "ktree", "hybrid"]:
             os.makedirs(case.bipsim_directory(method), exist_ok=True)
             n_cascade.to_bipsim(case.bipsim_directory(method), method)
         os.makedirs(case.copasi_directory(), exist_ok=True)
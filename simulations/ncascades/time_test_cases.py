@@ -13,7 +13,7 @@ def main():
     for case in test_case.read_file(case_file):
         for method in ["ssa", "nf"]:
             time_case(case.bionetgen_directory(method))
-        for method in ["vector", "tree", "hybrid"]:
+        for method in ["vector", "sorting", "tree", "ktree", "hybrid"]:
             time_case(case.bipsim_directory(method))
         copasi_time = time_case(case.copasi_directory())
 
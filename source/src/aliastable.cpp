@@ -0,0 +1,114 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file aliastable.cpp
+ * @brief Implementation of the AliasTable class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <numeric> // std::accumulate
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "aliastable.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+AliasTable::AliasTable (int size)
+  : _rates (size, 0)
+  , _thresholds (size, 1)
+  , _aliases (size, 0)
+  , _total_rate (0)
+{
+  /** @pre size must be positive. */
+  REQUIRE (size >= 0);
+  _small.reserve (size);
+  _large.reserve (size);
+  for (int i = 0; i < size; ++i) { _aliases [i] = i; }
+}
+
+// Not needed for this class (use of compiler-generated versions)
+// AliasTable::AliasTable (const AliasTable& other_table);
+// AliasTable& AliasTable::operator= (const AliasTable& other_table);
+// AliasTable::~AliasTable (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void AliasTable::update_cumulates (void)
+{
+  _total_rate = std::accumulate (_rates.begin(), _rates.end(), 0.0);
+  if (_total_rate == 0) { return; }
+
+  // scale rates so that the average bin contains exactly 1, then split bins
+  // between those lacking and those exceeding the average
+  int n = size();
+  double scale = n / _total_rate;
+  _small.clear(); _large.clear();
+  for (int i = 0; i < n; ++i)
+    {
+      _thresholds [i] = _rates [i] * scale;
+      _aliases [i] = i;
+      if (_thresholds [i] < 1) { _small.push_back (i); }
+      else { _large.push_back (i); }
+    }
+
+  // fill every small bin with the excess of a large bin
+  while (!_small.empty() && !_large.empty())
+    {
+      int small = _small.back(); _small.pop_back();
+      int large = _large.back();
+      _aliases [small] = large;
+      _thresholds [large] -= 1 - _thresholds [small];
+      if (_thresholds [large] < 1) { _large.pop_back(); _small.push_back (large); }
+    }
+
+  // remaining bins are full up to rounding errors
+  for (std::size_t i = 0; i < _large.size(); ++i) 
+    { _thresholds [_large [i]] = 1; }
+  for (std::size_t i = 0; i < _small.size(); ++i) 
+    { _thresholds [_small [i]] = 1; }
+}
+
+void AliasTable::assign (const std::vector <double>& rates)
+{
+  if (rates.size() != _rates.size())
+    {
+      _thresholds.resize (rates.size());
+      _aliases.resize (rates.size());
+    }
+  _rates = rates;
+  update_cumulates();
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+
+// =================
+//  Private Methods
+// =================
+//
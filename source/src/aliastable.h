@@ -0,0 +1,196 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file aliastable.h
+ * @brief Header for the AliasTable class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+#include "macros.h" // REQUIRE() ENSURE()
+#include "ratecontainer.h"
+
+/**
+ * @brief Class storing rates in an alias table.
+ *
+ * AliasTable inherits RateContainer. Rates are stored in a vector and an
+ * alias table is built from them (Walker's method, using Vose's construction)
+ * when prompted. Random drawing of a rate then only requires one uniform 
+ * random number and a single comparison. Therefore, its update cost is O(N)
+ * and its random drawing O(1), where N is the number of rates stored. It is
+ * best suited to rates that remain constant during many drawings.
+ * @sa RateVector
+ */
+class AliasTable : public RateContainer
+{
+ public:
+
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Constructor.
+   * @param size Size of the table (0 by default).
+   */
+  AliasTable (int size = 0);
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // AliasTable (const AliasTable& other_table);
+  // /* @brief Assignment operator. */
+  // AliasTable& operator= (const AliasTable& other_table);
+  // /* @brief Destructor. */
+  // ~AliasTable (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  // Redefined from RateContainer
+  void update_cumulates (void);
+  int random_index (void) const;
+  void set_rate (int index, double value);
+
+  /**
+   * @brief Replace all rates and rebuild table.
+   * @param rates New rate values (the size of the table is adjusted).
+   */
+  void assign (const std::vector <double>& rates);
+
+  /**
+   * @brief Find rate index corresponding to a uniform value.
+   * @param value Value drawn uniformly in [0, size()).
+   * @return Index of the bin containing the value or its alias, as of last
+   *  update.
+   */
+  int find (double value) const;
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  // Redefined from RateContainer
+  double total_rate (void) const;
+
+  /**
+   * @brief Accessor to table size.
+   * @return Number of rates stored in the table.
+   */
+  int size (void) const;
+
+  /**
+   * @brief Accessor to individual rates.
+   * @param index Index of rate in the table.
+   * @return Rate corresponding to given index.
+   */
+  const double& operator[] (int index) const;
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Vector of rates. */
+  std::vector <double> _rates;
+
+  /** @brief Probability to keep bin index rather than its alias. */
+  std::vector <double> _thresholds;
+
+  /** @brief Alias of every bin. */
+  std::vector <int> _aliases;
+
+  /** @brief Total rate as of last update. */
+  double _total_rate;
+
+  /** @brief Indices of bins with less than average rate (used for update). */
+  std::vector <int> _small;
+
+  /** @brief Indices of bins with more than average rate (used for update). */
+  std::vector <int> _large;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "randomhandler.h"
+
+inline int AliasTable::random_index (void) const
+{
+  /** @pre Total rate must be strictly positive. */
+  REQUIRE (total_rate() > 0);
+  return find (RandomHandler::instance().draw_uniform 
+	       (0.0, static_cast <double> (_rates.size())));
+}
+
+inline int AliasTable::find (double value) const
+{
+  /** @pre value must be within table bounds. */
+  REQUIRE ((value >= 0) && (value <= _rates.size()));
+  // integer part gives the bin, fractional part decides between bin and alias
+  int bin = static_cast <int> (value);
+  if (bin == size()) { --bin; }
+  if ((value - bin) < _thresholds [bin]) { return bin; }
+  return _aliases [bin];
+}
+
+inline void AliasTable::set_rate (int index, double value)
+{
+  /** @pre index must be within table bounds. */
+  REQUIRE ((index >= 0) && (index < size()));
+  /** @pre value must be positive. */
+  REQUIRE (value >= 0);
+  _rates [index] = value;
+}
+
+inline double AliasTable::total_rate (void) const
+{
+  return _total_rate;
+}
+
+inline int AliasTable::size (void) const
+{
+  return _rates.size();
+}
+
+inline const double& AliasTable::operator[] (int index) const
+{
+  return _rates [index];
+}
+
+#endif // ALIAS_TABLE_H
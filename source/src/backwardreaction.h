@@ -63,7 +63,8 @@ public:
    *  BidirectionalReaction whose backward part will be accessed by the adapter.
    */
   BackwardReaction (BidirectionalReaction& bidirectional_reaction)
-    : _reaction (bidirectional_reaction)
+    : Reaction (adapter_type (bidirectional_reaction, false))
+    , _reaction (bidirectional_reaction)
   {
     _reactants = _reaction.backward_reactants();
     _products = _reaction.forward_reactants();
@@ -110,6 +111,9 @@ private:
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // redefined from Reaction
   virtual void do_reaction (void) { _reaction.perform_backward(); }
   virtual double compute_rate (void) const { return _reaction.backward_rate(); }
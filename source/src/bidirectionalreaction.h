@@ -186,16 +186,18 @@ public:
 
 inline double BidirectionalReaction::forward_rate ( void ) const
 {
+  double rate = compute_forward_rate();
   /** @post Rate must be positive. */
-  ENSURE (compute_forward_rate() >= 0);
-  return compute_forward_rate();
+  ENSURE (rate >= 0);
+  return rate;
 }
 
 inline double BidirectionalReaction::backward_rate ( void ) const
 {
+  double rate = compute_backward_rate();
   /** @post Rate must be positive. */
-  ENSURE (compute_backward_rate() >= 0);
-  return compute_backward_rate();
+  ENSURE (rate >= 0);
+  return rate;
 }
 
 inline const std::vector<Reactant*>&
@@ -91,6 +91,17 @@ public:
   virtual void update (void);
 #endif
 
+  /**
+   * @brief Perform necessary actions when the number of sequences carrying
+   *  the site has changed.
+   * @param delta Change in the number of sequences.
+   */
+#ifndef PERFORM_TESTS
+  void update_population (int delta);
+#else
+  virtual void update_population (int delta);
+#endif
+
   /**
    * @brief Change update_id to pass along when update occurs.
    * @param new_id Positive integer representing new id to pass along.
@@ -265,6 +276,11 @@ inline void BindingSite::update (void)
   _family.update (_update_id);  
 }
  
+inline void BindingSite::update_population (int delta)
+{
+  _family.update_population (_update_id, delta);  
+}
+
 inline void BindingSite::set_update_id (int new_id)
 {
   _update_id = new_id;
@@ -31,16 +31,22 @@
 #include "randomhandler.h"
 #include "macros.h"
 #include "ratevalidity.h"
+#include "siteblock.h"
+#include "ratetree.h"
 
 // ==========================
 //  Constructors/Destructors
 // ==========================
 //
 BindingSiteFamily::BindingSiteFamily (void) 
-  : _rate_validity (0)
+  : _rate_contributions (0)
+  , _number_available_blocks (0)
+  , _rate_validity (0)
   , _rate_validity_size (10)
+  , _block_validity (0)
 {
   _rate_validity = new RateValidity (_rate_validity_size);
+  _block_validity = new RateValidity (_rate_validity_size);
 }
 
 // Forbidden
@@ -49,7 +55,10 @@ BindingSiteFamily::BindingSiteFamily (void)
 
 BindingSiteFamily::~BindingSiteFamily (void)
 {
+  delete _rate_contributions;
   delete _rate_validity;
+  delete _block_validity;
+  for (std::size_t i = 0; i < _blocks.size(); ++i) { delete _blocks [i]; }
 }
 
 // ===========================
@@ -60,20 +69,38 @@ void BindingSiteFamily::add (BindingSite* site)
 {
   // store binding site
   _binding_sites.push_back (site);
-
-  // extend contribution vector
+  int site_index = _binding_sites.size()-1;
   _rate_validity->extend (1);
-  _rate_contributions.extend (1);
+
+  // look for the block of the sequence carrying the site, create it if needed
+  std::map <const ChemicalSequence*, int>::iterator block_it = 
+    _block_indices.find (&site->location());
+  if (block_it == _block_indices.end())
+    {
+      block_it = _block_indices.insert 
+	(std::make_pair (&site->location(), _blocks.size())).first;
+      _blocks.push_back (new SiteBlock);
+      _block_validity->extend (1);
+      _available_blocks.push_back (false);
+
+      // rate tree has a fixed size, it is rebuilt at next update
+      delete _rate_contributions;
+      _rate_contributions = 0;
+    }
+  _site_blocks.push_back (block_it->second);
+  _site_ranks.push_back (_blocks [block_it->second]->add_site 
+			 (site_index, site->k_on(), 
+			  availability_level (site_index)));
 
   // configure update
-  site->set_update_id (_rate_contributions.size()-1);
+  site->set_update_id (site_index);
   site->location().watch_site (*site);
 }
 
 void BindingSiteFamily::update (int site_index)
 {  
   /** @pre site_index must be within family range. */
-  REQUIRE ((site_index >= 0) && (site_index < _rate_contributions.size()));
+  REQUIRE ((site_index >= 0) && (site_index < _binding_sites.size()));
 
   _rate_validity->invalidate (site_index);
       
@@ -81,24 +108,23 @@ void BindingSiteFamily::update (int site_index)
   notify_change();
 }
 
+void BindingSiteFamily::update_population (int site_index, int delta)
+{  
+  /** @pre site_index must be within family range. */
+  REQUIRE ((site_index >= 0) && (site_index < _binding_sites.size()));
+
+  int block = _site_blocks [site_index];
+  _blocks [block]->shift_levels (delta);
+  _block_validity->invalidate (block);
+
+  // notify change to rate managers
+  notify_change();
+}
+
 // ============================
 //  Public Methods - Accessors
 // ============================
 //
-bool BindingSiteFamily::is_site_available (void) const
-{
-  update_rates();
-  // we loop through sites and return as soon as we find that is available
-  int number_sites = _binding_sites.size();
-  for (int i = 0; i < number_sites; ++i)
-   {
-     if (_rate_contributions [i] > 0) return true;
-   }
-
-  // if we arrive here, it means that all sites are occupied
-  return false;
-}
-
 bool BindingSiteFamily::contains (const BindingSite* site) const
 {
   for (std::vector<BindingSite*>::const_iterator bs_it = _binding_sites.begin();
@@ -113,11 +139,41 @@ bool BindingSiteFamily::contains (const BindingSite* site) const
 //
 void BindingSiteFamily::update_rates (void) const
 {
+  /** @pre Family must contain at least one site. */
+  REQUIRE (_blocks.size() > 0);
+
+  if (_rate_contributions == 0)
+    {
+      _rate_contributions = new RateTree (_blocks.size());
+      for (std::size_t block = 0; block < _blocks.size(); ++block)
+	{ _block_validity->invalidate (block); }
+    }
   while (!_rate_validity->empty())
     {
       int site_index = _rate_validity->front();
-      _rate_contributions.set_rate 
-	(site_index, _binding_sites [site_index]->binding_rate());
+      int block = _site_blocks [site_index];
+      _blocks [block]->set_level (_site_ranks [site_index],
+				  availability_level (site_index));
+      _block_validity->invalidate (block);
       _rate_validity->pop();
     }
+  while (!_block_validity->empty())
+    {
+      int block = _block_validity->front();
+      double rate = _blocks [block]->total_rate();
+      _rate_contributions->set_rate (block, rate);
+      if (_available_blocks [block] != (rate > 0))
+	{
+	  _available_blocks [block] = (rate > 0);
+	  _number_available_blocks += (rate > 0) ? 1 : -1;
+	}
+      _block_validity->pop();
+    }
+  _rate_contributions->update_cumulates();
+}
+
+int BindingSiteFamily::availability_level (int site_index) const
+{
+  const BindingSite& site = *(_binding_sites [site_index]);
+  return site.location().availability_level (site.first(), site.last());
 }
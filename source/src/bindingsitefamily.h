@@ -26,6 +26,7 @@
 // ==================
 //
 #include <vector> // std::vector
+#include <map> // std::map
 
 // ==================
 //  Project Includes
@@ -34,8 +35,6 @@
 #include "forwarddeclarations.h"
 #include "reactant.h"
 #include "simulatorinput.h"
-#include "updatedtotalratevector.h"
-// #include "flyratevector.h"
 
 /**
  * @brief Class handling a family of binding sites.
@@ -43,7 +42,10 @@
  * BindingSiteFamily stores references to all binding sites of
  * a same family (which try to load the same chemical). It computes
  * the contribution to binding rates of each site depending on their
- * occupation and affinity.
+ * occupation and affinity. Contributions are cumulated per sequence in a
+ * RateTree, so that updating a contribution or drawing a site costs O(logN)
+ * where N is the number of sites. The number of sequences carrying available
+ * sites is maintained along with contributions.
  */
 class BindingSiteFamily : public Reactant, public SimulatorInput
 {
@@ -83,6 +85,18 @@ class BindingSiteFamily : public Reactant, public SimulatorInput
    */
   void update (int site_index);
 
+  /**
+   * @brief Update contributions given that the number of sequences carrying
+   *  a binding site has changed.
+   * @param site_index Index of a binding site located on the sequence.
+   * @param delta Change in the number of sequences.
+   *
+   * Availability of all sites of the family located on the same sequence
+   * shifts by delta. Contributions of these sites are updated lazily and only
+   * the total contribution of the sequence is recomputed.
+   */
+  void update_population (int site_index, int delta);
+
   // ============================
   //  Public Methods - Accessors
   // ============================
@@ -107,10 +121,9 @@ class BindingSiteFamily : public Reactant, public SimulatorInput
    * @brief Checks whether a site from this family is currently available.
    * @return True if there is at least one site available.
    *
-   * Note that compared to the rate accessors, this accessor is based on the
-   * current state of the cell, not that at the time of the last 
-   * update_rate_contributions(). Some computations are involved in this
-   * accessor, but it is less expensive than update_rate_contributions().
+   * Pending contributions are updated before answering, after which the
+   * answer is given in constant time from the number of sequences carrying
+   * available sites.
    */
   bool is_site_available (void) const;
 
@@ -126,43 +139,79 @@ private:
   //  Private Methods
   // =================
   //
-  /** @brief Update rates according to RateValidity object. */
+  /** @brief Update rates according to RateValidity objects. */
   void update_rates (void) const;
 
+  /**
+   * @brief Compute availability level of a site.
+   * @param site_index Index of the binding site.
+   * @return Number of sequences minus occupancy of the site.
+   */
+  int availability_level (int site_index) const;
+
   // ============
   //  Attributes
   // ============
   /** @brief Binding sites belonging to the family. */
   std::vector <BindingSite*> _binding_sites;
 
-  /** @brief Contribution of each binding site to the binding rate. */
-  mutable UpdatedTotalRateVector _rate_contributions;
-  //  mutable FlyRateVector _rate_contributions;
+  /** @brief Blocks of binding sites located on a same sequence. */
+  std::vector <SiteBlock*> _blocks;
+
+  /** @brief Index of the block of each sequence carrying sites. */
+  std::map <const ChemicalSequence*, int> _block_indices;
+
+  /** @brief Index of the block of each binding site. */
+  std::vector <int> _site_blocks;
+
+  /** @brief Index of each binding site within its block. */
+  std::vector <int> _site_ranks;
 
-  /** @brief RateValidity object monitoring rates to update. */
+  /** @brief Contribution of each block to the binding rate (built lazily). */
+  mutable RateContainer* _rate_contributions;
+
+  /** @brief Whether each block currently has an available site. */
+  mutable std::vector <bool> _available_blocks;
+
+  /** @brief Number of blocks currently having an available site. */
+  mutable int _number_available_blocks;
+
+  /** @brief RateValidity object monitoring sites to update. */
   mutable RateValidity* _rate_validity;
 
   /** @brief Current size of rate validity object. */
   mutable int _rate_validity_size;
 
+  /** @brief RateValidity object monitoring block contributions to update. */
+  mutable RateValidity* _block_validity;
+
 };
 
 // ======================
 //  Inline declarations
 // ======================
 //
+#include "siteblock.h"
+#include "ratecontainer.h"
+
 inline double BindingSiteFamily::total_binding_rate (void) const
 {
   update_rates();
-  return _rate_contributions.total_rate();
+  return _rate_contributions->total_rate();
 }
 
 inline 
 const BindingSite& BindingSiteFamily::random_available_site (void) const
 {
   update_rates();
-  _rate_contributions.update_cumulates();
-  return *(_binding_sites [_rate_contributions.random_index()]);
+  SiteBlock* block = _blocks [_rate_contributions->random_index()];
+  return *(_binding_sites [block->random_site()]);
+}
+
+inline bool BindingSiteFamily::is_site_available (void) const
+{
+  update_rates();
+  return (_number_available_blocks > 0);
 }
 
 #endif // BINDING_SITE_FAMILY_H
@@ -0,0 +1,135 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file bindingsiteindex.cpp
+ * @brief Implementation of the BindingSiteIndex class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <algorithm> // std::stable_sort std::max
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "bindingsiteindex.h"
+#include "bindingsite.h"
+#include "macros.h" // REQUIRE
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+BindingSiteIndex::BindingSiteIndex (void)
+  : _modified (false)
+{
+}
+
+// Not needed for this class (use of compiler-generated versions)
+// BindingSiteIndex::BindingSiteIndex (const BindingSiteIndex& other);
+// BindingSiteIndex& BindingSiteIndex::operator= (const BindingSiteIndex& other);
+// BindingSiteIndex::~BindingSiteIndex (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void BindingSiteIndex::add_site (BindingSite& site)
+{
+  _sites.push_back (&site);
+  _modified = true;
+}
+
+void BindingSiteIndex::update (int a, int b) const
+{
+  /** @pre a must be smaller or equal to b. */
+  REQUIRE (a <= b);
+  if (_modified) { build(); }
+  update (0, _sites.size(), a, b);
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+bool BindingSiteIndex::overlaps (int a, int b) const
+{
+  /** @pre a must be smaller or equal to b. */
+  REQUIRE (a <= b);
+  if (_modified) { build(); }
+  return overlaps (0, _sites.size(), a, b);
+}
+
+// =================
+//  Private Methods
+// =================
+//
+void BindingSiteIndex::build (void) const
+{
+  // stable sort keeps sites starting at the same position in insertion order
+  std::stable_sort (_sites.begin(), _sites.end(), StartsBefore());
+  _max_last.resize (_sites.size());
+  build (0, _sites.size());
+  _modified = false;
+}
+
+int BindingSiteIndex::build (int begin, int end) const
+{
+  if (begin >= end) { return -1; }
+  int middle = (begin + end) / 2;
+  _max_last [middle] = std::max (_sites [middle]->last(),
+				 std::max (build (begin, middle),
+					   build (middle+1, end)));
+  return _max_last [middle];
+}
+
+void BindingSiteIndex::update (int begin, int end, int a, int b) const
+{
+  if (begin >= end) { return; }
+  int middle = (begin + end) / 2;
+
+  // no site of the subtree reaches a
+  if (_max_last [middle] < a) { return; }
+  update (begin, middle, a, b);
+
+  // sites from middle onwards start after b
+  if (_sites [middle]->first() > b) { return; }
+  if (_sites [middle]->last() >= a) { _sites [middle]->update(); }
+  update (middle+1, end, a, b);
+}
+
+bool BindingSiteIndex::overlaps (int begin, int end, int a, int b) const
+{
+  if (begin >= end) { return false; }
+  int middle = (begin + end) / 2;
+
+  // same pruning as update, stopping at the first overlapping site
+  if (_max_last [middle] < a) { return false; }
+  if (overlaps (begin, middle, a, b)) { return true; }
+  if (_sites [middle]->first() > b) { return false; }
+  if (_sites [middle]->last() >= a) { return true; }
+  return overlaps (middle+1, end, a, b);
+}
+
+bool BindingSiteIndex::StartsBefore::operator() (const BindingSite* site_1,
+						 const BindingSite* site_2) const
+{
+  return site_1->first() < site_2->first();
+}
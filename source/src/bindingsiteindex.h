@@ -0,0 +1,175 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file bindingsiteindex.h
+ * @brief Header for the BindingSiteIndex class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef BINDING_SITE_INDEX_H
+#define BINDING_SITE_INDEX_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+
+/**
+ * @brief Class indexing the binding sites of a sequence by position.
+ *
+ * BindingSiteIndex is an interval tree stored in a sorted vector: sites are
+ * sorted by first position and the vector is read as a balanced binary search
+ * tree (the middle element of every range being the root of the range). Each
+ * node stores the largest last position of its subtree, so that subtrees
+ * containing no site overlapping a segment can be skipped. Finding the k
+ * sites overlapping a segment is O(k logN) at most, where N is the number of
+ * sites. Sites can be added at any time, the tree is rebuilt lazily at the
+ * next query.
+ */
+class BindingSiteIndex
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Default constructor.
+   */
+  BindingSiteIndex (void);
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // BindingSiteIndex (const BindingSiteIndex& other);
+  // /* @brief Assignment operator. */
+  // BindingSiteIndex& operator= (const BindingSiteIndex& other);
+  // /* @brief Destructor. */
+  // ~BindingSiteIndex (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  /**
+   * @brief Add site to index.
+   * @param site BindingSite.
+   */
+  void add_site (BindingSite& site);
+
+  /**
+   * @brief Update all sites overlapping a given segment.
+   * @param a Start of segment within which sites should be updated.
+   * @param b End of segment within which sites should be updated.
+   */
+  void update (int a, int b) const;
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  /**
+   * @brief Accessor to number of sites.
+   * @return Number of sites in the index.
+   */
+  int size (void) const;
+
+  /**
+   * @brief Check whether a site overlaps a given segment.
+   * @param a Start of segment.
+   * @param b End of segment.
+   * @return True if at least one site overlaps [a,b].
+   */
+  bool overlaps (int a, int b) const;
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Sites sorted by first position. */
+  mutable std::vector <BindingSite*> _sites;
+
+  /** @brief Largest last position of the subtree rooted at each site. */
+  mutable std::vector <int> _max_last;
+
+  /** @brief Whether sites were added since the tree was last built. */
+  mutable bool _modified;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+  /** @brief Functor ordering sites by first position. */
+  class StartsBefore
+  {
+  public:
+    bool operator() (const BindingSite* site_1, 
+		     const BindingSite* site_2) const;
+  };
+
+  /**
+   * @brief Sort sites and compute subtree maxima.
+   */
+  void build (void) const;
+
+  /**
+   * @brief Compute subtree maxima of a range of sites.
+   * @param begin Index of the first site of the range.
+   * @param end Index past the last site of the range.
+   * @return Largest last position within the range (-1 if empty).
+   */
+  int build (int begin, int end) const;
+
+  /**
+   * @brief Update sites of a range overlapping a given segment.
+   * @param begin Index of the first site of the range.
+   * @param end Index past the last site of the range.
+   * @param a Start of segment within which sites should be updated.
+   * @param b End of segment within which sites should be updated.
+   */
+  void update (int begin, int end, int a, int b) const;
+
+  /**
+   * @brief Check whether a site of a range overlaps a given segment.
+   * @param begin Index of the first site of the range.
+   * @param end Index past the last site of the range.
+   * @param a Start of segment.
+   * @param b End of segment.
+   * @return True if at least one site of the range overlaps [a,b].
+   */
+  bool overlaps (int begin, int end, int a, int b) const;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+inline int BindingSiteIndex::size (void) const
+{
+  return _sites.size();
+}
+
+#endif // BINDING_SITE_INDEX_H
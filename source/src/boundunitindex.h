@@ -0,0 +1,327 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+/**
+ * @file boundunitindex.h
+ * @brief Header for the BoundUnitIndex class.
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+// Multiple include protection
+//
+#ifndef BOUND_UNIT_INDEX_H
+#define BOUND_UNIT_INDEX_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "boundunitlist.h"
+#include "macros.h" // REQUIRE
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+
+/**
+ * @brief Class storing units bound to a sequence ordered by position.
+ * @details BoundUnitIndex stores bound units in a BoundUnitList, so that
+ *  binding and unbinding are O(1) and moving a unit only flags the order as
+ *  outdated. Units are sorted by first position lazily, when a query needs
+ *  it: a full sort after units were added or removed, an insertion sort
+ *  (linear when units only moved by a few positions) after moves. Queries
+ *  on an up to date order are logarithmic in the number of units bound.
+ *  Units are not assigned to a specific instance of the sequence, so
+ *  neighbour queries are only meaningful for sequences with a single copy.
+ */
+class BoundUnitIndex
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Default constructor.
+   */
+  BoundUnitIndex (void);
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // BoundUnitIndex (const BoundUnitIndex& other);
+  // /* @brief Assignment operator. */
+  // BoundUnitIndex& operator= (const BoundUnitIndex& other);
+  // /* @brief Destructor. */
+  // ~BoundUnitIndex (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  /**
+   * @brief Add unit to index.
+   * @param unit BoundUnit to add.
+   */
+  void add (BoundUnit& unit);
+
+  /**
+   * @brief Remove unit from index.
+   * @param unit BoundUnit to remove.
+   * @details If the unit is not found, the index remains unchanged.
+   */
+  void remove (BoundUnit& unit);
+
+  /**
+   * @brief Notify that a stored unit moved along the sequence.
+   */
+  void notify_move (void);
+  
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  /**
+   * @brief Accessor to index size.
+   * @return Number of units stored in index.
+   */
+  int size (void) const;
+
+  /**
+   * @brief Closest unit downstream of a position.
+   * @param position Position along the sequence.
+   * @return Unit with smallest first position strictly greater than
+   *  position, 0 if there is none.
+   */
+  BoundUnit* next_unit (int position) const;
+
+  /**
+   * @brief Closest unit upstream of a position.
+   * @param position Position along the sequence.
+   * @return Unit with largest first position strictly smaller than
+   *  position, 0 if there is none.
+   */
+  BoundUnit* previous_unit (int position) const;
+
+  /**
+   * @brief Number of free positions downstream of a position.
+   * @param position Position along the sequence.
+   * @return Number of positions between position and the first position of
+   *  the next unit downstream, NO_UNIT if there is none.
+   */
+  int gap_downstream (int position) const;
+
+  /**
+   * @brief Check whether a segment collides with a stored unit.
+   * @param first First position of the segment.
+   * @param last Last position of the segment.
+   * @return True if at least one stored unit occupies a position within
+   *  [first, last].
+   */
+  bool collides (int first, int last) const;
+
+  // ==================
+  //  Public Constants
+  // ==================
+  //
+  /** @brief Value returned by gap queries when no unit is found. */
+  static const int NO_UNIT = -1;
+
+private:
+  // =================
+  //  Private Methods
+  // =================
+  //
+  /** @brief Functor comparing first positions of units and positions. */
+  class FirstPosition
+  {
+  public:
+    bool operator() (const BoundUnit* unit_1, const BoundUnit* unit_2) const;
+    bool operator() (const BoundUnit* unit, int position) const;
+    bool operator() (int position, const BoundUnit* unit) const;
+  };
+
+  /**
+   * @brief Bring sorted units up to date.
+   */
+  void sort (void) const;
+
+  /**
+   * @brief Position of first unit starting at or after a position.
+   * @param position Position along the sequence.
+   * @return Index in sorted units.
+   */
+  int lower_bound (int position) const;
+
+  /**
+   * @brief Position of first unit starting strictly after a position.
+   * @param position Position along the sequence.
+   * @return Index in sorted units.
+   */
+  int upper_bound (int position) const;
+
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Units stored in arbitrary order. */
+  BoundUnitList _units;
+
+  /** @brief Units sorted by first position (when up to date). */
+  mutable std::vector <BoundUnit*> _sorted;
+
+  /** @brief Whether units were added or removed since last sort. */
+  mutable bool _modified;
+
+  /** @brief Whether units moved since last sort. */
+  mutable bool _moved;
+
+  /** @brief Largest footprint of units stored so far. */
+  int _max_footprint;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include <algorithm> // std::sort std::lower_bound std::upper_bound
+#include "boundunit.h"
+
+inline BoundUnitIndex::BoundUnitIndex (void)
+  : _modified (false)
+  , _moved (false)
+  , _max_footprint (0)
+{
+}
+
+inline void BoundUnitIndex::add (BoundUnit& unit)
+{
+  int footprint = unit.last() - unit.first() + 1;
+  if (footprint > _max_footprint) { _max_footprint = footprint; }
+  _units.add (unit);
+  _modified = true;
+}
+
+inline void BoundUnitIndex::remove (BoundUnit& unit)
+{
+  _units.remove (unit);
+  _modified = true;
+}
+
+inline void BoundUnitIndex::notify_move (void)
+{
+  _moved = true;
+}
+
+inline int BoundUnitIndex::size (void) const
+{
+  return _units.size();
+}
+
+inline BoundUnit* BoundUnitIndex::next_unit (int position) const
+{
+  int i = upper_bound (position);
+  if (i == int (_sorted.size())) { return 0; }
+  return _sorted [i];
+}
+
+inline BoundUnit* BoundUnitIndex::previous_unit (int position) const
+{
+  int i = lower_bound (position);
+  if (i == 0) { return 0; }
+  return _sorted [i-1];
+}
+
+inline int BoundUnitIndex::gap_downstream (int position) const
+{
+  int i = upper_bound (position);
+  if (i == int (_sorted.size())) { return NO_UNIT; }
+  return _sorted [i]->first() - position - 1;
+}
+
+inline bool BoundUnitIndex::collides (int first, int last) const
+{
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+
+  // only units starting less than one footprint before first can reach it
+  for (int i = lower_bound (first - _max_footprint + 1);
+       (i < int (_sorted.size())) && (_sorted [i]->first() <= last); ++i)
+    {
+      if (_sorted [i]->last() >= first) { return true; }
+    }
+  return false;
+}
+
+inline void BoundUnitIndex::sort (void) const
+{
+  if (_modified)
+    {
+      _sorted = _units();
+      std::sort (_sorted.begin(), _sorted.end(), FirstPosition());
+    }
+  else if (_moved)
+    {
+      // units only moved by a few positions: order is nearly preserved
+      for (std::size_t i = 1; i < _sorted.size(); ++i)
+	{
+	  BoundUnit* unit = _sorted [i];
+	  std::size_t j = i;
+	  for (; (j > 0) && (_sorted [j-1]->first() > unit->first()); --j)
+	    { _sorted [j] = _sorted [j-1]; }
+	  _sorted [j] = unit;
+	}
+    }
+  _modified = _moved = false;
+}
+
+inline int BoundUnitIndex::lower_bound (int position) const
+{
+  sort();
+  return std::lower_bound (_sorted.begin(), _sorted.end(), position,
+			   FirstPosition()) - _sorted.begin();
+}
+
+inline int BoundUnitIndex::upper_bound (int position) const
+{
+  sort();
+  return std::upper_bound (_sorted.begin(), _sorted.end(), position,
+			   FirstPosition()) - _sorted.begin();
+}
+
+inline bool BoundUnitIndex::FirstPosition::operator() 
+  (const BoundUnit* unit_1, const BoundUnit* unit_2) const
+{
+  return unit_1->first() < unit_2->first();
+}
+
+inline bool BoundUnitIndex::FirstPosition::operator() 
+  (const BoundUnit* unit, int position) const
+{
+  return unit->first() < position;
+}
+
+inline bool BoundUnitIndex::FirstPosition::operator() 
+  (int position, const BoundUnit* unit) const
+{
+  return position < unit->first();
+}
+
+#endif // BOUND_UNIT_INDEX_H
@@ -136,7 +136,7 @@ void ChemicalReaction::perform_forward (void)
       if (_backward_bound != 0) { _backward_bound->add (unit); }
       else
 	{
-	  unit.location().unbind_unit (unit.first(), unit.last());
+	  unit.location().unbind_unit (unit);
 	  BoundUnitFactory::instance().free(unit);
 	}
     }
@@ -162,7 +162,7 @@ void ChemicalReaction::perform_backward (void)
       if (_forward_bound != 0) { _forward_bound->add (unit); }
       else
 	{
-	  unit.location().unbind_unit (unit.first(), unit.last());
+	  unit.location().unbind_unit (unit);
 	  BoundUnitFactory::instance().free(unit);
 	}
     }
@@ -206,30 +206,31 @@ void ChemicalReaction::print (std::ostream& output) const
 
 double ChemicalReaction::compute_forward_rate (void) const
 {
-  if (is_forward_reaction_possible() == false) { return 0; }
-
-  double rate = _forward_constant;
-  for (std::vector <CRFree>::const_iterator 
-  	 it = _free_forward.begin(); it != _free_forward.end(); ++it)
-    { 
-      rate *= contribution ((it->chemical)->number(), it->order);  
-    }
-
-  if (_forward_bound != 0) { rate *= _forward_bound->number(); }
-  return rate;
+  return mass_action_rate (_forward_constant, _free_forward, _forward_bound);
 }
 
 double ChemicalReaction::compute_backward_rate (void) const
 {
-  if (is_backward_reaction_possible() == false) { return 0; }
+  return mass_action_rate (_backward_constant, _free_backward,
+			   _backward_bound);
+}
 
-  double rate = _backward_constant;
-  for (std::vector <CRFree>::const_iterator 
-  	 it = _free_backward.begin(); it != _free_backward.end(); ++it)
+double ChemicalReaction::
+mass_action_rate (double constant, const std::vector <CRFree>& free_reactants,
+		  const BoundChemical* bound)
+{
+  // checking that there are enough reactants and multiplying contributions
+  // is done in a single pass over reactants
+  double rate = constant;
+  for (std::vector <CRFree>::const_iterator it = free_reactants.begin();
+       it != free_reactants.end(); ++it)
     { 
-      rate *= contribution ((it->chemical)->number(), it->order);  
+      int number = (it->chemical)->number();
+      if (number < it->stoichiometry) { return 0; }
+      rate *= contribution (number, it->order);  
     }
 
-  if (_backward_bound != 0) { rate *= _backward_bound->number(); }
+  // bound reactant has order 1, its contribution is zero if it is absent
+  if (bound != 0) { rate *= bound->number(); }
   return rate;
 }
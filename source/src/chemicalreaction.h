@@ -98,6 +98,17 @@ public:
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
+  /** @brief Free chemical with its stoichiometry and order. */
+  struct CRFree
+  {
+    FreeChemical* chemical;
+    int stoichiometry;
+    int order;
+  };
+
   // redefinitions from BidirectionalReaction
   double compute_forward_rate (void) const;
   double compute_backward_rate (void) const;
@@ -105,6 +116,17 @@ public:
 
   static double contribution (int number, int order);
 
+  /**
+   * @brief Compute mass action rate of one direction of the reaction.
+   * @param constant Rate constant (including volume).
+   * @param free_reactants Free reactants of the direction.
+   * @param bound Bound reactant of the direction (0 if none).
+   * @return Mass action rate, 0 if there are not enough reactants.
+   */
+  static double mass_action_rate (double constant,
+				  const std::vector <CRFree>& free_reactants,
+				  const BoundChemical* bound);
+
   bool is_forward_reaction_valid (void);
   bool is_backward_reaction_valid (void);
   
@@ -112,12 +134,6 @@ public:
   //  Attributes
   // ============
   //
-  struct CRFree
-  {
-    FreeChemical* chemical;
-    int stoichiometry;
-    int order;
-  };
 
   /** @brief Free forward reactants. */
   std::vector <CRFree> _free_forward;
@@ -159,6 +175,13 @@ public:
 inline double 
 ChemicalReaction::contribution (int number, int order)
 {  
+  // closed forms for the usual orders, falling factorial otherwise
+  switch (order)
+    {
+    case 0: return 1;
+    case 1: return number;
+    case 2: return number * (number - 1.0);
+    }
   double result = 1;
   order = number - order;
   while (number > order) { result *= number; --number; }
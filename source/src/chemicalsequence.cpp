@@ -28,6 +28,7 @@
 //
 #include "chemicalsequence.h"
 #include "bindingsite.h"
+#include "boundunit.h"
 
 // ==========================
 //  Constructors/Destructors
@@ -36,10 +37,12 @@
 ChemicalSequence::ChemicalSequence (const std::string& sequence,
 				    int starting_position /*= 1*/,
 				    bool is_circular /* = false */)
-  : _length (sequence.size())
+  : _id (next_id())
+  , _length (sequence.size())
   , _starting_position (starting_position)
   , _sequence (sequence)
   , _is_circular (is_circular)
+  , _has_switch_site (sequence.size(), false)
   , _appariated_sequence (0)
   , _occupation (sequence.size())
 {
@@ -54,25 +57,40 @@ ChemicalSequence::ChemicalSequence (const std::string& sequence,
 //  Public Methods - Commands
 // ===========================
 //
-void ChemicalSequence::bind_unit (int first, int last)
+void ChemicalSequence::bind_unit (BoundUnit& unit)
 {
-  /** @pre first must be smaller than last. */
-  REQUIRE (first <= last);
+  /** @pre Unit must be located on sequence. */
+  REQUIRE (&unit.location() == this);
   /** @pre Unit positions must be consistent with sequence length. */
-  REQUIRE (is_out_of_bounds (first, last) == false); 
+  REQUIRE (is_out_of_bounds (unit.first(), unit.last()) == false); 
 
-  _occupation.add_element (first, last);
+  _occupation.add_element (unit.first(), unit.last());
+  _bound_units.add (unit);
 }
 
 
-void ChemicalSequence::unbind_unit (int first, int last)
+void ChemicalSequence::unbind_unit (BoundUnit& unit)
 {
-  /** @pre first must be smaller than last. */
-  REQUIRE (first <= last);
+  /** @pre Unit must be located on sequence. */
+  REQUIRE (&unit.location() == this);
   /** @pre Unit positions must be consistent with sequence length. */
-  REQUIRE (is_out_of_bounds (first, last) == false); 
+  REQUIRE (is_out_of_bounds (unit.first(), unit.last()) == false); 
   
-  _occupation.remove_element (first, last);
+  _bound_units.remove (unit);
+  _occupation.remove_element (unit.first(), unit.last());
+}
+
+void ChemicalSequence::move_unit (BoundUnit& unit, int step)
+{
+  /** @pre Unit must be located on sequence. */
+  REQUIRE (&unit.location() == this);
+  /** @pre Moved unit must remain within sequence. */
+  REQUIRE (is_out_of_bounds (unit.first() + step, unit.last() + step) 
+	   == false); 
+
+  _occupation.move_element (unit.first(), unit.last(), step);
+  unit.move (step);
+  _bound_units.notify_move();
 }
 
 bool ChemicalSequence::extend_strand (int strand_id, int position)
@@ -37,6 +37,7 @@
 #include "forwarddeclarations.h"
 #include "freechemical.h"
 #include "sequenceoccupation.h"
+#include "boundunitindex.h"
 
 /**
  * @brief This class stores chemicals that can be described by a sequence.
@@ -78,18 +79,23 @@ public:
   void remove (int quantity);
 
   /**
-   * @brief Bind an element to the sequence.
-   * @param first First position occupied by element.
-   * @param last Last position occupied by element.
+   * @brief Bind a unit to the sequence.
+   * @param unit BoundUnit located on the sequence.
    */
-  void bind_unit (int first, int last);
+  void bind_unit (BoundUnit& unit);
 
   /**
-   * @brief Unbinds an element from sequence.
-   * @param first First position occupied by element.
-   * @param last Last position occupied by element.
+   * @brief Unbinds a unit from sequence.
+   * @param unit BoundUnit located on the sequence.
    */
-  void unbind_unit (int first, int last);
+  void unbind_unit (BoundUnit& unit);
+
+  /**
+   * @brief Move a bound unit along the sequence.
+   * @param unit BoundUnit located on the sequence.
+   * @param step Number of positions by which the unit moves.
+   */
+  void move_unit (BoundUnit& unit, int step);
 
   /**
    * @brief Extend partial strand at given position.
@@ -139,6 +145,15 @@ public:
    */
   int number_available_sites (int first, int last) const;
 
+  /**
+   * @brief Compute the availability level of a site.
+   * @param first Starting position of the site.
+   * @param last Ending position of the site.
+   * @return Number of unoccupied sites, negative if the site is occupied
+   *  more times than there are sequences.
+   */
+  int availability_level (int first, int last) const;
+
   /**
    * @brief Composition of partial strands.
    * @return Each entry of the list represents a different strand. Each strand
@@ -166,12 +181,41 @@ public:
    */
   const std::list<int>* switch_sites (int position) const;
 
+  /**
+   * @brief Returns whether a switch site lies within a segment.
+   * @param first Relative position of first base of segment.
+   * @param last Relative position of last base of segment.
+   * @return True if at least one position of the segment holds a switch site.
+   */
+  bool has_switch_site (int first, int last) const;
+
+  /**
+   * @brief Returns whether a binding site overlaps a segment.
+   * @param first Relative position of first base of segment.
+   * @param last Relative position of last base of segment.
+   * @return True if at least one binding site overlaps the segment.
+   */
+  bool has_binding_site (int first, int last) const;
+
+  /**
+   * @brief Accessor to units bound to the sequence.
+   * @return Index of bound units ordered by position (neighbour queries
+   *  are only meaningful if the sequence has a single copy).
+   */
+  const BoundUnitIndex& bound_units (void) const;
+
   /**
    * @brief Returns length of sequence.
    * @return Length of sequence.
    */
   int length (void) const;
 
+  /**
+   * @brief Accessor to sequence identifier.
+   * @return Identifier (sequences are numbered from 0 in creation order).
+   */
+  int id (void) const;
+
   /**
    * @brief Returns the whole sequence.
    * @return String representing chemical sequence.
@@ -228,10 +272,16 @@ private:
    */
   void print (std::ostream& output) const;
 
+  /** @brief Function returning next id. */
+  static int next_id (void) { static int next_id = 0; return next_id++; }
+
   // ============
   //  Attributes
   // ============
   //
+  /** @brief Identifier. */
+  int _id;
+
   /** @brief Length of the sequence. */
   int _length;
 
@@ -247,11 +297,17 @@ private:
   /** @brief Switch sites on the sequence. */
   std::map <int, std::list <int> > _switch_sites;
 
+  /** @brief Flags positions holding at least one switch site. */
+  std::vector <bool> _has_switch_site;
+
   /** @brief Appariated sequence. */
   ChemicalSequence* _appariated_sequence;
 
   /** @brief Sequence occupation of the chemical. */
   SequenceOccupation _occupation;
+
+  /** @brief Units bound to the sequence ordered by position. */
+  BoundUnitIndex _bound_units;
 };
 
 // ======================
@@ -279,6 +335,16 @@ int ChemicalSequence::number_available_sites (int first, int last) const
   return _occupation.number_available_sites (first, last);
 }
 
+inline 
+int ChemicalSequence::availability_level (int first, int last) const
+{
+  /** @pre first must be smaller than last. */
+  REQUIRE (first <= last);
+  /** @pre first and last must be within sequence bound. */
+  REQUIRE (!is_out_of_bounds (first, last));
+  return _occupation.availability_level (first, last);
+}
+
 inline 
 std::list <std::vector <int> > ChemicalSequence::partial_strands (void) const
 {
@@ -290,6 +356,11 @@ inline int ChemicalSequence::length (void) const
   return _length;
 }
 
+inline int ChemicalSequence::id (void) const
+{ 
+  return _id;
+}
+
 inline bool ChemicalSequence::is_out_of_bounds (int first, int last) const
 {
   /** @pre first must be smaller than last. */
@@ -345,18 +416,49 @@ inline int ChemicalSequence::complementary (int position) const
 inline void ChemicalSequence::add_switch_site (int position, int identifier)
 {
   _switch_sites[position].push_back (identifier);
+  if (is_out_of_bounds (position, position) == false)
+    { _has_switch_site [position] = true; }
+}
+
+inline const BoundUnitIndex& ChemicalSequence::bound_units (void) const
+{
+  return _bound_units;
 }
 
 inline const std::list<int>* ChemicalSequence::switch_sites (int position) const
 {
   /** @pre Position must be within sequence. */
   REQUIRE (is_out_of_bounds (position, position) == false); 
-  
+
+  // most positions (e.g. along elongation) hold no switch
+  if (_has_switch_site [position] == false) { return 0; }
   const std::map <int, std::list<int> >::const_iterator 
     local_sites = _switch_sites.find (position);
   if (local_sites == _switch_sites.end()) { return 0; }
   else { return &(local_sites->second); }
 }
 
+inline bool ChemicalSequence::has_switch_site (int first, int last) const
+{
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+  /** @pre Segment must be within sequence. */
+  REQUIRE (!is_out_of_bounds (first, last));
+
+  for (int i = first; i <= last; ++i)
+    { if (_has_switch_site [i]) { return true; } }
+  return false;
+}
+
+inline bool ChemicalSequence::has_binding_site (int first, int last) const
+{
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+  /** @pre Segment must be within sequence. */
+  REQUIRE (!is_out_of_bounds (first, last));
+
+  return _occupation.has_binding_site (first, last);
+}
+
 
 #endif // CHEMICALSEQUENCE_H
@@ -36,6 +36,8 @@
 #include "randomhandler.h"
 #include "macros.h" // REQUIRE
 #include "naiveratemanager.h"
+#include "simulationparams.h"
+#include "ratecontainerfactory.h"
 
 // ==========================
 //  Constructors/Destructors
@@ -44,7 +46,9 @@
 ConstantRateGroup::ConstantRateGroup (const SimulationParams& params,
 				      const std::vector<Reaction*>& reactions,
 				      double initial_time, double time_step)
-  : _rate_manager (params, reactions)
+  // rates are frozen during the time step, so they are drawn in O(1) from an
+  // alias table
+  : _rate_manager (params, reactions, AliasTableFactory())
   , _next_reaction_time (initial_time)
   , _next_reaction (0)
   , _final_time (initial_time + time_step)
@@ -66,8 +70,13 @@ void ConstantRateGroup::schedule_next_reaction (double current_time)
 {
   if (current_time >= _final_time) { reinitialize (current_time); }
 
-  _next_reaction_time = current_time + 
-    RandomHandler::instance().draw_exponential (_rate_manager.total_rate());
+  // if no reaction can occur, we wait for the end of the time step
+  if (_rate_manager.total_rate() > 0)
+    {
+      _next_reaction_time = current_time + RandomHandler::instance().
+	draw_exponential (_rate_manager.total_rate());
+    }
+  else { _next_reaction_time = _final_time; }
   if (_next_reaction_time < _final_time) 
     { 
       _next_reaction = &(_rate_manager.random_reaction()); 
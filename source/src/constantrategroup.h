@@ -46,7 +46,8 @@
  * computes the reaction schedule for the time step at once (limited to
  * MAX_NUMBER_REACTIONS to avoid high memory usage, scheduling is performed in 
  * several steps if necessary). Access to their timing and performing them is
- * therefore extremely quick.
+ * therefore extremely quick. As rates are frozen during the time step, they
+ * are stored in an AliasTable that draws reactions in constant time.
  * This class inherits class ReactionGroup.
  * @sa ReactionGroup
  * @sa UpdatedRateGroup
@@ -30,9 +30,6 @@
 // ==================
 //
 #include "dependencyratemanager.h"
-#include "reactant.h"
-#include "reaction.h"
-#include "rateinvalidator.h"
 
 // ==========================
 //  Constructors/Destructors
@@ -43,16 +40,8 @@ DependencyRateManager::DependencyRateManager (const SimulationParams& params,
   : RateManager (params, reactions)
   , _rate_validity (reactions.size())
 {
-  const std::vector <Reaction*>& _reactions = this->reactions();
-
-  // loop through reactions and create observers
-  for (std::size_t i = 0; i < _reactions.size(); ++i)
-    {
-      const std::vector <Reactant*>& reactants = _reactions [i]->reactants();
-      for (std::vector <Reactant*>::const_iterator reactant_it = reactants.begin();
-	   reactant_it != reactants.end(); ++reactant_it)
-	{ (*reactant_it)->attach (_rate_validity.invalidator (i)); }
-    }
+  // compile reactant to reaction dependencies and attach observers
+  _rate_validity.watch (this->reactions());
 }
 
 // DependencyRateManager::DependencyRateManager (const DependencyRateManager& other);
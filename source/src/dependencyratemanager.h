@@ -45,7 +45,8 @@
  * update only those reactions which rate might have been changed. It acts as an
  * observer: it attaches itself to all reactants it knows and receives updates
  * when concentrations change. All rates that may have changed are stored in a
- * set until user asks to update rates.
+ * set until user asks to update rates. Dependencies are compiled at
+ * construction so that a reactant change notifies the manager once.
  */
 class DependencyRateManager : public RateManager
 {
@@ -70,7 +71,7 @@ class DependencyRateManager : public RateManager
   /** @brief Assignment operator. */
   DependencyRateManager& operator= (const DependencyRateManager& other);
  public:
-  
+  // Not needed for this class (use of compiler-generated versions)
   // /* @brief Destructor. */
   // ~DependencyRateManager (void);
 
@@ -93,6 +94,17 @@ class DependencyRateManager : public RateManager
   // ============================
   //
 
+ protected:
+  // ===================
+  //  Protected Methods
+  // ===================
+  //
+  /**
+   * @brief Accessor to rate validity.
+   * @return Container storing rate indices to update.
+   */
+  RateValidity& rate_validity (void);
+
 private:
   // =================
   //  Private Methods
@@ -113,12 +125,16 @@ private:
 //
 inline void DependencyRateManager::update_rates (void)
 {
-  while (!_rate_validity.empty())
-    {
-      update_reaction (_rate_validity.front());
-      _rate_validity.pop();
-    }
+  const std::vector <int>& invalid_rates = _rate_validity.invalid_rates();
+  for (std::size_t i = 0; i < invalid_rates.size(); ++i)
+    { update_reaction (invalid_rates [i]); }
+  _rate_validity.clear();
   cumulate_rates();
 }
 
+inline RateValidity& DependencyRateManager::rate_validity (void)
+{
+  return _rate_validity;
+}
+
 #endif // DEPENDENCY_RATE_MANAGER_H
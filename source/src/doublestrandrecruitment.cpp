@@ -41,7 +41,8 @@ DoubleStrandRecruitment::DoubleStrandRecruitment (BoundChemical& recruiter,
 						  FreeChemical& recruit,
 						  BoundChemical& bound_recruit,
 						  double rate)
-  : _recruiter (recruiter)
+  : Reaction (DOUBLE_STRAND_RECRUITMENT)
+  , _recruiter (recruiter)
   , _recruit (recruit)
   , _bound_recruit (bound_recruit)
   , _rate (rate)
@@ -99,7 +100,7 @@ void DoubleStrandRecruitment::do_reaction (void)
 	create (appariated_strand, first, last, reading_frame);
       recruited_unit.set_strand (unit.strand());
       _bound_recruit.add (recruited_unit);
-      appariated_strand.bind_unit (first, last);
+      appariated_strand.bind_unit (recruited_unit);
     }
 }
 
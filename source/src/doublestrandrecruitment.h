@@ -89,6 +89,9 @@ class DoubleStrandRecruitment : public Reaction
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // Redefined from Reaction.
   void do_reaction (void);
   double compute_rate (void) const;
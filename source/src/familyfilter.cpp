@@ -39,6 +39,7 @@
 //
 FamilyFilter::FamilyFilter (const BindingSiteFamily& family)
   : _family (&family)
+  , _number_units (0)
 {
 }
 
@@ -56,14 +57,41 @@ inline void FamilyFilter::add (BoundUnit& unit)
   if ((unit.binding_site() != 0)
       && (&(unit.binding_site()->family()) == _family)
       && (unit.binding_site()->first() == unit.first())) 
-    { _units.add (unit); }
+    {
+      // look for the group of units sharing the same k_off, create if needed
+      double k_off = unit.binding_site()->k_off();
+      std::map <double, int>::iterator group_it = _group_indices.find (k_off);
+      if (group_it == _group_indices.end())
+	{
+	  group_it = _group_indices.insert
+	    (std::make_pair (k_off, _units.size())).first;
+	  _k_off.push_back (k_off);
+	  _units.push_back (BoundUnitList());
+	  _unbinding_rates.extend (1);
+	}
+      _units [group_it->second].add (unit);
+      ++_number_units;
+      update_rate (group_it->second);
+    }
 }
 
 inline void FamilyFilter::remove (BoundUnit& unit)
 {
   if ((unit.binding_site() != 0)
       && (&(unit.binding_site()->family()) == _family))
-    { _units.remove (unit); }
+    {
+      std::map <double, int>::iterator group_it = 
+	_group_indices.find (unit.binding_site()->k_off());
+      if (group_it == _group_indices.end()) { return; }
+
+      // unit may not have been stored (if it bound outside site start)
+      BoundUnitList& units = _units [group_it->second];
+      int old_size = units.size();
+      units.remove (unit);
+      if (units.size() == old_size) { return; }
+      --_number_units;
+      update_rate (group_it->second);
+    }
 }
 
 
@@ -72,16 +100,6 @@ inline void FamilyFilter::remove (BoundUnit& unit)
 // ============================
 //
 
-double FamilyFilter::total_unbinding_rate (void) const
-{
-  // we loop through the list and sum the k_off
-  double r_total = 0;
-  for (std::vector <BoundUnit*>::const_iterator it = _units().begin();
-       it != _units().end(); ++it)
-    { r_total += (*it)->binding_site()->k_off(); }
-  return r_total;
-}
-
 // =================
 //  Private Methods
 // =================
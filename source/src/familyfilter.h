@@ -25,7 +25,8 @@
 //  General Includes
 // ==================
 //
-
+#include <vector> // std::vector
+#include <map> // std::map
 
 // ==================
 //  Project Includes
@@ -33,6 +34,7 @@
 //
 #include "boundunitfilter.h"
 #include "boundunitlist.h"
+#include "updatedtotalratevector.h"
 
 // ======================
 //  Forward declarations
@@ -43,7 +45,11 @@
 /**
  * @brief Class filtering bound units belonging to a specific BindingSiteFamily.
  * @details FamilyFilter only stores bound units belonging to a specific 
- * BindingSiteFamily. It inherits BoundUnitFilter.
+ * BindingSiteFamily. It inherits BoundUnitFilter. Units are grouped by the
+ * unbinding rate of the site they bound to, and the unbinding rate of every
+ * group is updated whenever a unit enters or leaves it. Accessing the total
+ * unbinding rate is O(1) and drawing a unit is O(G), where G is the number of
+ * distinct unbinding rates within the family (usually very small).
  */
 class FamilyFilter : public BoundUnitFilter
 {
@@ -81,6 +87,10 @@ class FamilyFilter : public BoundUnitFilter
   // ============================
   //
   // redefined from BoundUnitFilter
+  /**
+   * @brief Pick random unit weighted by unbinding rate of its binding site.
+   * @return Random BoundUnit stored by the filter.
+   */
   BoundUnit& random_unit (void) const;
 
   /**
@@ -100,6 +110,11 @@ private:
   //  Private Methods
   // =================
   //
+  /**
+   * @brief Update unbinding rate of a group after its size changed.
+   * @param group Index of the group.
+   */
+  void update_rate (int group);
 
   // ============
   //  Attributes
@@ -108,8 +123,20 @@ private:
   /** @brief Family the units should have bounded to. */
   const BindingSiteFamily* _family;
 
-  /** @brief Units bounded to family provided at construction. */
-  BoundUnitList _units;
+  /** @brief Index of the group of units associated with every k_off. */
+  std::map <double, int> _group_indices;
+
+  /** @brief Unbinding rate of the units of every group. */
+  std::vector <double> _k_off;
+
+  /** @brief Units bounded to family, grouped by unbinding rate. */
+  std::vector <BoundUnitList> _units;
+
+  /** @brief Total unbinding rate of every group. */
+  mutable UpdatedTotalRateVector _unbinding_rates;
+
+  /** @brief Number of units stored in the filter. */
+  int _number_units;
 };
 
 // ======================
@@ -122,12 +149,25 @@ inline BoundUnit& FamilyFilter::random_unit (void) const
 {
   /** @pre Filter must not be empty. */
   REQUIRE (number() > 0);
-  return _units.random_unit();
+  _unbinding_rates.update_cumulates();
+  return _units [_unbinding_rates.random_index()].random_unit();
 }
 
 inline int FamilyFilter::number (void) const
 {
-  return _units.size();
+  return _number_units;
+}
+
+inline double FamilyFilter::total_unbinding_rate (void) const
+{
+  // an empty filter drops rounding residues of the running total
+  if (_number_units == 0) { return 0; }
+  return _unbinding_rates.total_rate();
+}
+
+inline void FamilyFilter::update_rate (int group)
+{
+  _unbinding_rates.set_rate (group, _k_off [group] * _units [group].size());
 }
 
 #endif // FAMILY_FILTER_H
@@ -41,13 +41,17 @@ class BoundUnitFactory;
 class SolverFactory;
 class NaiveSolverFactory;
 class ManualDispatchFactory;
+class NextReactionSolverFactory;
 class RateManagerFactory;
 class NaiveRateManagerFactory;
 class DependencyRateManagerFactory;
 class RateContainerFactory;
 class RateVectorFactory;
 class RateTreeFactory;
+class KaryRateTreeFactory;
 class HybridRateContainerFactory;
+class AliasTableFactory;
+class SortingRateVectorFactory;
 
 // reaction classes
 class BackwardReaction;
@@ -77,14 +81,17 @@ class FreeChemical;
 // site classes
 class BindingSite;
 class BindingSiteFamily;
+class SiteBlock;
 class Switch;
 
 // sequence related classes
+class BindingSiteIndex;
+class BoundUnitIndex;
 class ChemicalSequence;
 class DoubleStrand;
 class PartialStrand;
+class RangeMaxTree;
 class SequenceOccupation;
-class SiteGroup;
 
 // tables
 class CompositionTable;
@@ -118,6 +125,7 @@ class CellState;
 class ConstantRateGroup;
 class NaiveSolver;
 class ManualDispatchSolver;
+class NextReactionSolver;
 class ReactionGroup;
 class ReactionClassification;
 class Solver;
@@ -144,12 +152,18 @@ class SumNode;
 class DummyNode;
 class ReactionNode;
 
+class KaryRateTree;
+
 class HybridRateContainer;
 class RateGroup;
 class RateToken;
 
+class AliasTable;
+class SortingRateVector;
+
 // generic containers
 template <class T> class VectorQueue;
+template <typename T> class IndexedPriorityQueue;
 
 // exceptions
 class DependencyException;
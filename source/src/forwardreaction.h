@@ -62,7 +62,8 @@ public:
    *  BidirectionalReaction whose forward part will be accessed by the adapter.
    */
   ForwardReaction (BidirectionalReaction& bidirectional_reaction)
-    : _reaction (bidirectional_reaction)
+    : Reaction (adapter_type (bidirectional_reaction, true))
+    , _reaction (bidirectional_reaction)
   {
     _reactants = _reaction.forward_reactants();
     _products = _reaction.backward_reactants();
@@ -110,6 +111,9 @@ private:
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // Redefined from Reaction
   void do_reaction (void) { _reaction.perform_forward(); }
   double compute_rate (void) const { return _reaction.forward_rate(); }
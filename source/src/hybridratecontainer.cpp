@@ -13,7 +13,7 @@
 
 /**
  * @file hybridratecontainer.cpp
- * @brief Implementation of the ClassName class.
+ * @brief Implementation of the HybridRateContainer class.
  * 
  * @authors Marc Dinh, Stephan Fischer
  */
@@ -24,6 +24,7 @@
 // ==================
 //
 #include <iostream> // std::cout
+#include <algorithm> // std::sort
 
 // ==================
 //  Project Includes
@@ -38,40 +39,39 @@
 HybridRateContainer::HybridRateContainer (int number_rates, double base_rate)
   : _base_rate (base_rate)
   , _current_max_rate (base_rate)
-  , _tokens (number_rates)
-  , _groups (1)
-  , _group_container (1, false)
-  , _update_stack (new RateValidity (1))
+  , _groups (number_rates, NULL_GROUP)
+  , _positions (number_rates, 0)
+  , _group_indices (1)
+  , _group_values (1)
+  , _group_max_rates (1, base_rate)
+  , _group_rates (1, 0)
+  , _cumulated_rates (1, 0)
+  , _modified (false)
+  , _auto_base_rate (base_rate <= 0)
+  , _calibrated (false)
+  , _number_changes (0)
 {
-  // create one group to start with
-  _groups [0] = new RateGroup (0, base_rate);
-  
-  // initialize tokens
-  for (std::size_t i = 0; i < _tokens.size(); ++i)
-    {
-      _tokens [i] = new RateToken (i);
-      _tokens [i]->set_group (GroupKey(), NULL_GROUP);
-    }
+  // automatic base rate: provisional value until rates are known
+  if (_auto_base_rate) { _base_rate = _current_max_rate = 1; }
+  _group_max_rates [0] = _base_rate;
 }
 
 // Forbidden
 // HybridRateContainer::HybridRateContainer (const HybridRateContainer& other_container);
 // HybridRateContainer& HybridRateContainer::operator= (const HybridRateContainer& other_container);
-
-HybridRateContainer::~HybridRateContainer (void)
-{
-  // destroy groups, tokens and update stack
-  for (std::size_t i = 0; i < _groups.size(); ++i) { delete _groups [i]; }
-  for (std::size_t i = 0; i < _tokens.size(); ++i) { delete _tokens [i]; }
-  delete _update_stack;
-}
+// HybridRateContainer::~HybridRateContainer (void);
 
 
 // ===========================
 //  Public Methods - Commands
 // ===========================
 //
-
+void HybridRateContainer::update_cumulates (void)
+{
+  if (!_modified) { return; }
+  _compute_cumulates();
+  if (_is_unbalanced()) { _rebalance(); _compute_cumulates(); }
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -83,26 +83,88 @@ HybridRateContainer::~HybridRateContainer (void)
 //  Private Methods
 // =================
 //
+const double HybridRateContainer::FIRST_GROUP_COST = 0.5;
+const int HybridRateContainer::MAX_EMPTY_GROUPS;
+
+void HybridRateContainer::_compute_cumulates (void)
+{
+  double sum = 0;
+  for (std::size_t i = 0; i < _group_rates.size(); ++i)
+    { sum += _group_rates [i]; _cumulated_rates [i] = sum; }
+  _modified = false;
+}
+
+bool HybridRateContainer::_is_unbalanced (void) const
+{
+  if (!_auto_base_rate || (total_rate() <= 0)) { return false; }
+  if (!_calibrated) { return true; }
+
+  // redistribution is linear in number of rates: wait until enough rates
+  // changed for its cost to be amortized
+  if (_number_changes < _groups.size()) { return false; }
+
+  // first group draws cost more than rejection bound of other groups
+  if (first_group_cost() > 4*FIRST_GROUP_COST) { return true; }
+
+  // base rate has become too small compared to current rates
+  int first_non_empty = 0;
+  while (_group_indices [first_non_empty].empty()) { ++first_non_empty; }
+  return (first_non_empty > MAX_EMPTY_GROUPS);
+}
+
+void HybridRateContainer::_rebalance (void)
+{
+  // collect and sort positive rates
+  std::vector <double> rates;
+  rates.reserve (_groups.size());
+  for (std::size_t i = 0; i < _group_values.size(); ++i)
+    {
+      rates.insert (rates.end(), _group_values [i].begin(),
+		    _group_values [i].end());
+    }
+  std::sort (rates.begin(), rates.end());
+
+  // the expected number of trials within first group for one drawing is
+  // (number of rates in first group) * base rate / total rate: choose the
+  // largest base rate keeping this cost below threshold
+  double max_cost = FIRST_GROUP_COST * total_rate();
+  std::size_t k = 0;
+  while ((k < rates.size()) && (rates [k] * (k+1) <= max_cost)) { ++k; }
+  double new_base_rate = (k > 0) ? rates [k-1] : rates [0] / 2;
+
+  // redistribute rates
+  std::vector <double> values (_groups.size(), 0);
+  for (std::size_t i = 0; i < _groups.size(); ++i)
+    {
+      if (_groups [i] != NULL_GROUP)
+	{ values [i] = _group_values [_groups [i]][_positions [i]]; }
+    }
+  _base_rate = _current_max_rate = new_base_rate;
+  _groups.assign (_groups.size(), NULL_GROUP);
+  _group_indices.assign (1, std::vector <int>());
+  _group_values.assign (1, std::vector <double>());
+  _group_max_rates.assign (1, _base_rate);
+  _group_rates.assign (1, 0);
+  _cumulated_rates.assign (1, 0);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      int group = _rate_to_group (values [i]);
+      if (group != NULL_GROUP) { _insert (i, group, values [i]); }
+    }
+  _calibrated = true;
+  _number_changes = 0;
+}
+
 void HybridRateContainer::_create_new_groups (double value)
 {
   // create new groups
   while (_current_max_rate <= value)
     {
-      _groups.push_back (new RateGroup (_current_max_rate, 
-					2*_current_max_rate));
       _current_max_rate *= 2;
+      _group_max_rates.push_back (_current_max_rate);
     }
-  
-  // extend group container
-  _group_container.extend (_groups.size() - _group_container.size ());
-
-  // create new update stack
-  RateValidity* new_update_stack = new RateValidity (_groups.size());
-  while (!_update_stack->empty())
-    {
-      new_update_stack->invalidate (_update_stack->front());
-      _update_stack->pop();
-    }
-  delete _update_stack;
-  _update_stack = new_update_stack;
+  _group_indices.resize (_group_max_rates.size());
+  _group_values.resize (_group_max_rates.size());
+  _group_rates.resize (_group_max_rates.size(), 0);
+  _cumulated_rates.resize (_group_max_rates.size(), _cumulated_rates.back());
 }
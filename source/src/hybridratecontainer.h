@@ -32,8 +32,6 @@
 // ==================
 //
 #include "ratecontainer.h"
-#include "flyratevector.h"
-// #include "ratevector.h"
 
 // ======================
 //  Forward declarations
@@ -45,13 +43,24 @@
  * @brief Class storing rates using groups of increasing size.
  *
  * HybridRateContainer inherits from RateContainer. Its uses a hybrid strategy
- * for selecting a random rate. At every update it classes rates into groups
- * bounded by a minimal value and a maximal value that are typically powers of
- * 2. A classical drawing is used to determine in which group the next reaction
- * will happen. Then a reaction in the group is selected using a rejection
- * method, the rejection probability being kept small as we know the minimal
- * and maximal value of rates stored within the group.
- * @sa RateGroup.
+ * for selecting a random rate (composition-rejection). At every update it
+ * classes rates into groups bounded by a minimal value and a maximal value
+ * that are typically powers of 2. A classical drawing is used to determine in
+ * which group the next reaction will happen. Then a reaction in the group is
+ * selected using a rejection method, the rejection probability being kept
+ * small as we know the minimal and maximal value of rates stored within the
+ * group.
+ *
+ * Rates, group indices and positions within groups are stored in parallel
+ * arrays indexed by rate, and every group stores the indices and rates of its
+ * members contiguously, so that a rejection iteration reads a single array
+ * and consumes a single uniform random number. Groups are drawn by scanning
+ * a small array of cumulated group rates, rebuilt at every update.
+ *
+ * If no base rate is provided, it is derived from the rates observed at the
+ * first update, and rates are periodically redistributed among groups when
+ * the first group (whose rejection is not bounded) becomes too costly or when
+ * the base rate becomes much smaller than every stored rate.
  */
 class HybridRateContainer : public RateContainer
 {
@@ -65,7 +74,8 @@ class HybridRateContainer : public RateContainer
    * @brief Constructor.
    * @param number_rates Number of rates to store.
    * @param base_rate Rate used to delimit the first group. The first group
-   *  should ideally collect only a very small number of rates.
+   *  should ideally collect only a very small number of rates. If 0, the base
+   *  rate is chosen automatically and adapted during the simulation.
    */
   HybridRateContainer (int number_rates, double base_rate);
 
@@ -77,10 +87,9 @@ class HybridRateContainer : public RateContainer
   HybridRateContainer& operator= (const HybridRateContainer& other_container);
 
  public:
-  /**
-   * @brief Destructor.
-   */
-  ~HybridRateContainer (void);
+  // Not needed for this class (use of compiler-generated versions)
+  // /* @brief Destructor. */
+  // ~HybridRateContainer (void);
 
   // ===========================
   //  Public Methods - Commands
@@ -104,6 +113,19 @@ class HybridRateContainer : public RateContainer
    */
   int number_groups (void) const;
 
+  /**
+   * @brief Accessor to current base rate.
+   * @return Maximal rate of the first group.
+   */
+  double base_rate (void) const;
+
+  /**
+   * @brief Compute expected number of rejection trials due to first group.
+   * @return Expected number of trials performed within the first group for
+   *  one drawing, given current rates.
+   */
+  double first_group_cost (void) const;
+
 private:
   // =================
   //  Private Methods
@@ -126,6 +148,50 @@ private:
    */
   void _create_new_groups (double value);
 
+  /**
+   * @brief Insert rate in a group.
+   * @param index Index of the rate.
+   * @param group Index of the group.
+   * @param value Rate value.
+   */
+  void _insert (int index, int group, double value);
+
+  /**
+   * @brief Remove rate from its current group.
+   * @param index Index of the rate.
+   */
+  void _remove (int index);
+
+  /**
+   * @brief Cumulate group rates.
+   */
+  void _compute_cumulates (void);
+
+  /**
+   * @brief Check whether groups should be rebuilt around a new base rate.
+   * @return True if base rate is automatic and groups are unbalanced.
+   */
+  bool _is_unbalanced (void) const;
+
+  /**
+   * @brief Choose base rate from current rates and redistribute them.
+   */
+  void _rebalance (void);
+
+  /**
+   * @brief Sum rates of a group from scratch.
+   * @param group Index of the group.
+   * @return Current total rate of the group.
+   */
+  double _compute_group_rate (int group) const;
+
+  /**
+   * @brief Draw a rate within a group using rejection method.
+   * @param group Index of the group.
+   * @return Index of the rate drawn.
+   */
+  int _random_index_in_group (int group) const;
+
   // ============
   //  Attributes
   // ============
@@ -136,19 +202,50 @@ private:
   /** @brief Current maximal rate that can be handled by the container. */
   double _current_max_rate;
 
-  /** @brief Vector of token representing rates that are passed to groups. */
-  std::vector <RateToken*> _tokens;
+  /** @brief Group every rate belongs to (NULL_GROUP for null rates). */
+  std::vector <int> _groups;
 
-  /** @brief Vector of groups. */
-  std::vector <RateGroup*> _groups;
+  /** @brief Position of every rate within its group. */
+  std::vector <int> _positions;
 
-  /** 
-   * @brief Container used to store the total rates associated with each group. 
+  /** @brief Rate indices stored in every group. */
+  std::vector < std::vector <int> > _group_indices;
+
+  /** @brief Rate values stored in every group (parallel to indices). */
+  std::vector < std::vector <double> > _group_values;
+
+  /** @brief Maximal rate of every group. */
+  std::vector <double> _group_max_rates;
+
+  /** @brief Current total rate of every group. */
+  std::vector <double> _group_rates;
+
+  /** @brief Cumulated group rates as of last update. */
+  std::vector <double> _cumulated_rates;
+
+  /** @brief Whether group rates changed since last update. */
+  bool _modified;
+
+  /** @brief Whether base rate is chosen automatically. */
+  bool _auto_base_rate;
+
+  /** @brief Whether automatic base rate was computed at least once. */
+  bool _calibrated;
+
+  /** @brief Number of rate modifications since last redistribution. */
+  int _number_changes;
+
+  /**
+   * @brief Maximal expected number of rejection trials in first group
+   *  accepted when choosing base rate.
    */
-  FlyRateVector _group_container;
+  static const double FIRST_GROUP_COST;
 
-  /** @brief Stack storing group indices that need to be updated. */
-  RateValidity* _update_stack;
+  /**
+   * @brief Maximal number of empty groups accepted below the first group
+   *  containing rates before base rate is recomputed.
+   */
+  static const int MAX_EMPTY_GROUPS = 4;
 
   /** @brief Constant used to specify that a rate is not stored in any group. */
   static const int NULL_GROUP = -1;
@@ -159,36 +256,65 @@ private:
 // ======================
 //
 #include <cmath> // frexp()
+#include <iostream> // std::ostream
 
 #include "macros.h"
-#include "rategroup.h"
-#include "ratevalidity.h"
-#include "ratetoken.h"
+#include "randomhandler.h"
 
-inline void HybridRateContainer::update_cumulates (void)
+inline int HybridRateContainer::random_index (void) const
 {
-  while (!_update_stack->empty())
-    {	
-      int next = _update_stack->front();
-      _group_container.set_rate (next, _groups [next]->total_rate());
-      _update_stack->pop();
-    }
-  _group_container.update_cumulates();
+  /** @pre Total rate must be strictly positive. */
+  REQUIRE (total_rate() > 0);
+
+  // count groups whose cumulated rate is strictly smaller than drawn value
+  double u = RandomHandler::instance().draw_uniform
+    (1e-16*total_rate(), total_rate());
+  int group = 0;
+  for (std::size_t i = 0; i < _cumulated_rates.size(); ++i)
+    { group += (_cumulated_rates [i] < u); }
+
+  // rounding may lead to groups that are empty or out of range
+  if (group == _cumulated_rates.size()) { --group; }
+  while (_group_indices [group].empty()) { --group; }
+  return _random_index_in_group (group);
 }
 
-inline int HybridRateContainer::random_index (void) const
+inline int HybridRateContainer::_random_index_in_group (int group) const
 {
-  return _groups [_group_container.random_index()]->random_index();
+  // the integer part of the drawn value gives the candidate, the fractional
+  // part is compared with its rate relative to the group maximum
+  const std::vector <double>& values = _group_values [group];
+  double size = values.size();
+  double threshold = _group_max_rates [group];
+  while (true)
+    {
+      double u = RandomHandler::instance().draw_uniform (0.0, size);
+      int candidate = static_cast <int> (u);
+      if (candidate == values.size()) { continue; }
+      if ((u - candidate) * threshold < values [candidate])
+	{ return _group_indices [group][candidate]; }
+    }
 }
 
 inline double HybridRateContainer::total_rate (void) const
 { 
-  return _group_container.total_rate();
+  return _cumulated_rates.back();
 }
 
 inline int HybridRateContainer::number_groups (void) const
 { 
-  return _groups.size();
+  return _group_indices.size();
+}
+
+inline double HybridRateContainer::base_rate (void) const
+{ 
+  return _base_rate;
+}
+
+inline double HybridRateContainer::first_group_cost (void) const
+{
+  if (total_rate() <= 0) { return 0; }
+  return _group_indices [0].size() * _base_rate / total_rate();
 }
 
 inline void HybridRateContainer::set_rate (int index, double value)
@@ -197,24 +323,64 @@ inline void HybridRateContainer::set_rate (int index, double value)
    * @pre Index must be consistent with number of rates provided at
    * construction.
    */
-  REQUIRE ((index >= 0) && (index < _tokens.size()));
-  
-  RateToken* token = _tokens [index];
-  
-  // remove token from previous group
-  if (token->group() != NULL_GROUP) 
-    { 
-      _groups [token->group()]->remove (token); 
-      _update_stack->invalidate (token->group());
+  REQUIRE ((index >= 0) && (index < _groups.size()));
+  /** @pre value must be positive. */
+  REQUIRE (value >= 0);
+
+  int new_group = _rate_to_group (value);
+  if (new_group == _groups [index])
+    {
+      // update value in place
+      if (new_group == NULL_GROUP) { return; }
+      double& stored = _group_values [new_group][_positions [index]];
+      _group_rates [new_group] += value - stored;
+      stored = value;
+      if (_group_rates [new_group] < 0)
+	{ _group_rates [new_group] = _compute_group_rate (new_group); }
     }
-  
-  // add to new group
-  token->set_group (GroupKey(), _rate_to_group (value));
-  if (token->group() != NULL_GROUP)
-    { 
-      _groups [token->group()]->insert (token, value);
-      _update_stack->invalidate (token->group());
+  else
+    {
+      if (_groups [index] != NULL_GROUP) { _remove (index); }
+      if (new_group != NULL_GROUP) { _insert (index, new_group, value); }
     }
+  _modified = true;
+  ++_number_changes;
+}
+
+inline void HybridRateContainer::_insert (int index, int group, double value)
+{
+  _groups [index] = group;
+  _positions [index] = _group_indices [group].size();
+  _group_indices [group].push_back (index);
+  _group_values [group].push_back (value);
+  _group_rates [group] += value;
+}
+
+inline void HybridRateContainer::_remove (int index)
+{
+  int group = _groups [index];
+  int position = _positions [index];
+  std::vector <int>& indices = _group_indices [group];
+  std::vector <double>& values = _group_values [group];
+  
+  // overwrite element with current last element
+  _group_rates [group] -= values [position];
+  _positions [indices.back()] = position;
+  indices [position] = indices.back(); indices.pop_back();
+  values [position] = values.back(); values.pop_back();
+  _groups [index] = NULL_GROUP;
+
+  if (indices.empty()) { _group_rates [group] = 0; }
+  else if (_group_rates [group] < 0)
+    { _group_rates [group] = _compute_group_rate (group); }
+}
+
+inline double HybridRateContainer::_compute_group_rate (int group) const
+{
+  const std::vector <double>& values = _group_values [group];
+  double result = 0;
+  for (std::size_t i = 0; i < values.size(); ++i) { result += values [i]; }
+  return result;
 }
 
 inline int HybridRateContainer::_rate_to_group (double value)
@@ -222,25 +388,23 @@ inline int HybridRateContainer::_rate_to_group (double value)
   if (value == 0) { return NULL_GROUP; }
   if (value <= _base_rate) { return 0; }
   if (value >= _current_max_rate)
-    { _create_new_groups (value); return _groups.size()-1; }
+    { _create_new_groups (value); return _group_indices.size()-1; }
   
   int group;
   frexp (value/_base_rate, &group);
   /** @post Index must be consistent with number of groups. */
-  ENSURE ((group > 0) && (group < _groups.size()));
+  ENSURE ((group > 0) && (group < _group_indices.size()));
   return group;
 }
 
 inline std::ostream& HybridRateContainer::_print (std::ostream& output) const
 {
-  for (std::vector <RateGroup*>::const_iterator r_it = _groups.begin();
-       r_it != _groups.end(); ++r_it)
+  for (std::size_t i = 0; i < _group_indices.size(); ++i)
     {	
-      output << (*r_it)->total_rate() << " ("
-		<< (*r_it)->size() << ") ";
+      output << _group_rates [i] << " ("
+	     << _group_indices [i].size() << ") ";
     }
   output << total_rate() << "\n";
-  output << _group_container << "\n";
   return output;
 }
 
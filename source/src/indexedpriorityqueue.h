@@ -0,0 +1,240 @@
+//
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+//
+//
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+
+/**
+ * @file indexedpriorityqueue.h
+ * @brief Header for the IndexedPriorityQueue class.
+ *
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+#include "macros.h" // REQUIRE() ENSURE()
+
+/**
+ * @brief Binary min-heap whose elements can be accessed by a fixed index.
+ *
+ * IndexedPriorityQueue stores a fixed number of values, each of them
+ * identified by an index chosen at construction (0 to size-1). Values are
+ * kept in a binary heap so that the index of the smallest value is available
+ * in O(1). Contrary to std::priority_queue, any value can be modified through
+ * its index at a cost of O(logN), where N is the number of values stored, as
+ * the position of every index within the heap is tracked.
+ */
+template <typename T>
+class IndexedPriorityQueue
+{
+ public:
+
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Constructor.
+   * @param size Number of values to store.
+   * @param initial_value Value given to all elements at construction.
+   */
+  IndexedPriorityQueue (int size = 0, const T& initial_value = T())
+    : _values (size, initial_value)
+    , _heap (size)
+    , _positions (size)
+  {
+    for (int i = 0; i < size; ++i) { _heap [i] = _positions [i] = i; }
+  }
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // IndexedPriorityQueue (const IndexedPriorityQueue& other);
+  // /* @brief Assignment operator. */
+  // IndexedPriorityQueue& operator= (const IndexedPriorityQueue& other);
+  // /* @brief Destructor. */
+  // ~IndexedPriorityQueue (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  /**
+   * @brief Change value associated with an index and restore heap order.
+   * @param index Index of the value to modify.
+   * @param value New value.
+   */
+  void update (int index, const T& value)
+  {
+    /** @pre index must be within queue bounds. */
+    REQUIRE ((index >= 0) && (index < size()));
+    T old_value = _values [index];
+    _values [index] = value;
+    if (value < old_value) { _sift_up (_positions [index]); }
+    else { _sift_down (_positions [index]); }
+  }
+
+  /**
+   * @brief Set all values at once and rebuild heap in O(N).
+   * @param values New values (must be of same size as queue).
+   */
+  void assign (const std::vector <T>& values)
+  {
+    /** @pre values must have the same size as the queue. */
+    REQUIRE (values.size() == _values.size());
+    _values = values;
+    for (int i = size()/2 - 1; i >= 0; --i) { _sift_down (i); }
+  }
+
+  /**
+   * @brief Add a new value at the end of the index range.
+   * @param value Value to store.
+   * @return Index attributed to the new value.
+   */
+  int push (const T& value)
+  {
+    int index = _values.size();
+    _values.push_back (value);
+    _heap.push_back (index);
+    _positions.push_back (index);
+    _sift_up (index);
+    return index;
+  }
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  /**
+   * @brief Accessor to index of smallest value.
+   * @return Index of the smallest value stored.
+   */
+  int top_index (void) const
+  {
+    /** @pre Queue must not be empty. */
+    REQUIRE (size() > 0);
+    return _heap [0];
+  }
+
+  /**
+   * @brief Accessor to smallest value.
+   * @return Smallest value stored.
+   */
+  const T& top_value (void) const
+  {
+    /** @pre Queue must not be empty. */
+    REQUIRE (size() > 0);
+    return _values [_heap [0]];
+  }
+
+  /**
+   * @brief Accessor to individual values.
+   * @param index Index of the value.
+   * @return Value currently associated with index.
+   */
+  const T& operator[] (int index) const { return _values [index]; }
+
+  /**
+   * @brief Accessor to number of values stored.
+   * @return Number of values stored.
+   */
+  int size (void) const { return _values.size(); }
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Values ordered by index. */
+  std::vector <T> _values;
+
+  /** @brief Binary heap of indices ordered by value. */
+  std::vector <int> _heap;
+
+  /** @brief Position of every index within the heap. */
+  std::vector <int> _positions;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+  /**
+   * @brief Move element up the heap until heap order is restored.
+   * @param position Position of the element in the heap.
+   */
+  void _sift_up (int position)
+  {
+    int index = _heap [position];
+    while (position > 0)
+      {
+	int parent = (position-1) / 2;
+	if (!(_values [index] < _values [_heap [parent]])) break;
+	_place (_heap [parent], position);
+	position = parent;
+      }
+    _place (index, position);
+  }
+
+  /**
+   * @brief Move element down the heap until heap order is restored.
+   * @param position Position of the element in the heap.
+   */
+  void _sift_down (int position)
+  {
+    int index = _heap [position];
+    int heap_size = _heap.size();
+    int child = 2*position + 1;
+    while (child < heap_size)
+      {
+	if ((child+1 < heap_size)
+	    && (_values [_heap [child+1]] < _values [_heap [child]]))
+	  { ++child; }
+	if (!(_values [_heap [child]] < _values [index])) break;
+	_place (_heap [child], position);
+	position = child;
+	child = 2*position + 1;
+      }
+    _place (index, position);
+  }
+
+  /**
+   * @brief Store index at a given heap position.
+   * @param index Index to store.
+   * @param position Position in the heap.
+   */
+  void _place (int index, int position)
+  {
+    _heap [position] = index;
+    _positions [index] = position;
+  }
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+
+#endif // INDEXED_PRIORITY_QUEUE_H
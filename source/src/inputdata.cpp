@@ -41,7 +41,6 @@ InputData::InputData (const std::vector <std::string>& input_file_names)
   , _input_line ("")
   , _eof (false)
 {
-  std::cout << "Opening input files... " << std::endl;
   // open files
   for (std::vector <std::string>::const_iterator 
 	 file_it = input_file_names.begin();
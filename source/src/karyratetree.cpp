@@ -0,0 +1,134 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file karyratetree.cpp
+ * @brief Implementation of the KaryRateTree class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <iostream> // std::cout
+#include <cmath> // fabs
+#include <cstddef> // std::size_t
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "karyratetree.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+const int KaryRateTree::ARITY;
+
+KaryRateTree::KaryRateTree (int number_rates)
+  : _number_rates (number_rates)
+{
+  /** @pre number_rates must be positive. */
+  REQUIRE (number_rates >= 0);
+
+  // compute level sizes from the leaves up to the root, every level is
+  // padded to a multiple of ARITY so that sibling blocks are aligned
+  std::vector <int> sizes;
+  int size = number_rates;
+  do
+    {
+      size = ((size + ARITY - 1) / ARITY) * ARITY;
+      if (size == 0) { size = ARITY; }
+      sizes.push_back (size);
+      size /= ARITY;
+    }
+  while (size > 1);
+  sizes.push_back (ARITY);
+
+  // root level comes first
+  int total_size = 0;
+  for (int l = sizes.size() - 1; l >= 0; --l)
+    {
+      _level_starts.push_back (total_size);
+      total_size += sizes [l];
+    }
+
+  // align first node on a cache line (64 bytes)
+  const std::size_t line_size = 64;
+  _storage.assign (total_size + line_size/sizeof (double), 0);
+  std::size_t address = reinterpret_cast <std::size_t> (&_storage [0]);
+  _nodes = &_storage [0] 
+    + ((line_size - address % line_size) % line_size) / sizeof (double);
+
+  _awaiting_update.assign (total_size, false);
+  _to_update.reserve (sizes [0] / ARITY);
+  _next_to_update.reserve (sizes [0] / ARITY);
+}
+
+// Forbidden
+// KaryRateTree::KaryRateTree (const KaryRateTree& other_tree);
+// KaryRateTree& KaryRateTree::operator= (const KaryRateTree& other_tree);
+// KaryRateTree::~KaryRateTree (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void KaryRateTree::update_cumulates (void)
+{
+  // update modified nodes level by level, so that a node shared by several
+  // modified leaves is only recomputed once
+  for (int l = _level_starts.size() - 2; l >= 0; --l)
+    {
+      double* nodes = level (l);
+      const double* children = level (l+1);
+      for (std::size_t i = 0; i < _to_update.size(); ++i)
+	{
+	  int index = _to_update [i];
+	  const double* block = children + ARITY*index;
+	  double sum = 0;
+	  for (int c = 0; c < ARITY; ++c) { sum += block [c]; }
+	  nodes [index] = sum;
+	  _awaiting_update [_level_starts [l] + index] = false;
+
+	  if (l > 0)
+	    {
+	      int parent = index / ARITY;
+	      if (!_awaiting_update [_level_starts [l-1] + parent])
+		{
+		  _awaiting_update [_level_starts [l-1] + parent] = true;
+		  _next_to_update.push_back (parent);
+		}
+	    }
+	}
+      _to_update.swap (_next_to_update);
+      _next_to_update.clear();
+    }
+
+  // total must be approximately equal to sum of leaf nodes 
+  ENSURE (fabs (total_rate() - _sum_of_leaf_rates()) <= 1e-13*total_rate());
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+
+// =================
+//  Private Methods
+// =================
+//
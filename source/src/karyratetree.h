@@ -0,0 +1,258 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file karyratetree.h
+ * @brief Header for the KaryRateTree class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef KARY_RATE_TREE_H
+#define KARY_RATE_TREE_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+#include "ratecontainer.h"
+
+/**
+ * @brief Class storing rates using an implicit k-ary tree to cumulate rates.
+ *
+ * KaryRateTree inherits from RateContainer. Like RateTree, it cumulates rates
+ * in a tree, but the tree is stored level by level in a single array: the
+ * children of node j are stored contiguously at positions [k*j, k*j+k) of the
+ * next level. With k = 8, the children of a node fill exactly one (aligned)
+ * cache line and are scanned without branching when going down the tree.
+ * Modified rates are recorded and their ancestors are updated level by level
+ * when cumulates are updated, so that every node is recomputed at most once.
+ * Both operations are O(k*log_k(N)) where N is the number of stored rates.
+ * @sa RateTree.
+ */
+class KaryRateTree : public RateContainer
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Constructor.
+   * @param number_rates Number of rates to store.
+   */
+  KaryRateTree (int number_rates);
+
+ private:
+  // Forbidden
+  /** @brief Copy constructor. */
+  KaryRateTree (const KaryRateTree& other_tree);
+  /** @brief Assignment operator. */
+  KaryRateTree& operator= (const KaryRateTree& other_tree);
+
+ public:
+  // Not needed for this class (use of compiler-generated versions)
+  // /* @brief Destructor. */
+  // ~KaryRateTree (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  // Redefined from RateContainer
+  int random_index (void) const;
+  void update_cumulates (void);
+  void set_rate (int index, double value);
+
+  /**
+   * @brief Find reaction index corresponding to cumulated rate value.
+   * @param value Cumulated rate value.
+   * @return Reaction index such that the cumulated rate < index
+   *  is smaller than cumulated_value while the cumulated rate <= index
+   *  is greater or equal to cumulated_value. This index is computed from
+   *  the cumulated rates as of last update, not current rates.
+   */
+  int find (double value) const;
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  // Redefined from RateContainer
+  double total_rate (void) const;
+
+  // ==================
+  //  Public Constants
+  // ==================
+  //
+  /** @brief Number of children per node. */
+  static const int ARITY = 8;
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Storage for nodes (slightly oversized for alignment). */
+  std::vector <double> _storage;
+
+  /** @brief Nodes of tree, aligned on a cache line (root level first). */
+  double* _nodes;
+
+  /** @brief Position of first node of every level (root level first). */
+  std::vector <int> _level_starts;
+
+  /** @brief Number of rates stored. */
+  int _number_rates;
+
+  /** @brief Whether every node is awaiting update. */
+  std::vector <bool> _awaiting_update;
+
+  /** @brief Indices (within their level) of nodes awaiting update. */
+  std::vector <int> _to_update;
+
+  /** @brief Indices of nodes awaiting update on the next level up. */
+  std::vector <int> _next_to_update;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+  // Redefined from RateContainer
+  std::ostream& _print (std::ostream& output) const;
+
+  /**
+   * @brief Accessor to first node of a level.
+   * @param level Level of the tree (0 for root).
+   * @return Pointer to the first node of the level.
+   */
+  double* level (int level) const;
+
+  /**
+   * @brief Compute sum of rates contained in leaves directly.
+   * @return Sum of rates contained in leaves.
+   *
+   * This function is for verification purposes.
+   */
+  double _sum_of_leaf_rates (void) const;  
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h"
+
+inline double* KaryRateTree::level (int level) const
+{
+  return _nodes + _level_starts [level];
+}
+
+inline int KaryRateTree::find (double value) const
+{
+  /** @pre value must be smaller than total tree rate. */
+  REQUIRE (value <= total_rate());
+  /** @pre value must be strictly positive. */
+  REQUIRE (value > 0);
+
+  int index = 0;
+  int leaf_level = _level_starts.size() - 1;
+  for (int l = 0; l < leaf_level; ++l)
+    {
+      // count children whose cumulated rate is strictly smaller than value
+      // (branchless so that the loop can be unrolled and vectorized)
+      const double* children = level (l+1) + ARITY*index;
+      double cumulate = 0, previous = 0;
+      int selected = 0;
+      for (int c = 0; c < ARITY-1; ++c)
+	{
+	  cumulate += children [c];
+	  bool below = (cumulate < value);
+	  selected += below;
+	  previous = below ? cumulate : previous;
+	}
+      // rarely, rounding makes us pick a child with zero rate, we take the
+      // previous nonzero sibling instead
+      while ((children [selected] == 0) && (selected > 0)) { --selected; }
+      value -= previous;
+      index = ARITY*index + selected;
+    }
+
+  /** @post Rate of returned leaf must be strictly positive. */
+  ENSURE ((index < _number_rates) && (level (leaf_level) [index] > 0));
+  return index;
+}
+
+inline double KaryRateTree::total_rate (void) const
+{
+  /** @post Total rate should be positive. */
+  ENSURE (_nodes [0] >= 0);
+  return _nodes [0];
+}
+
+inline void KaryRateTree::set_rate (int index, double value)
+{
+  /** @pre index must be consistent with number of rates. */
+  REQUIRE ((index >= 0) && (index < _number_rates));
+  /** @pre Rate value must be nonnegative. */
+  REQUIRE (value >= 0);
+
+  int leaf_level = _level_starts.size() - 1;
+  double& leaf = level (leaf_level) [index];
+  if (leaf == value) { return; }
+  leaf = value;
+
+  // record parent for next update
+  int parent = index / ARITY;
+  if (!_awaiting_update [_level_starts [leaf_level-1] + parent])
+    {
+      _awaiting_update [_level_starts [leaf_level-1] + parent] = true;
+      _to_update.push_back (parent);
+    }
+}
+
+inline int KaryRateTree::random_index (void) const
+{
+  /** Total rate must be strictly positive. */
+  ENSURE (total_rate() > 0);
+  return find (RandomHandler::instance().draw_uniform
+	       (1e-16*total_rate(), total_rate()));
+}
+
+inline double KaryRateTree::_sum_of_leaf_rates (void) const
+{
+  const double* leaves = level (_level_starts.size() - 1);
+  double total = 0;
+  for (int i = 0; i < _number_rates; ++i) { total += leaves [i]; }
+  return total;
+}
+
+inline std::ostream& KaryRateTree::_print (std::ostream& output) const
+{
+  const double* leaves = level (_level_starts.size() - 1);
+  for (int i = 0; i < _number_rates; ++i) { output << leaves [i] << " "; }
+  output << total_rate();
+  return output;
+}
+
+#endif // KARY_RATE_TREE_H
@@ -37,8 +37,10 @@
 //  Constructors/Destructors
 // ==========================
 //
-Loading::Loading (BoundChemical& loader, const LoadingTable& table)
-  : _loader (loader)
+Loading::Loading (BoundChemical& loader, LoadingTable& table,
+		  Type type)
+  : Reaction (type)
+  , _loader (loader)
   , _table (table)
   , _template_filter (table)
   , _volume_constant (1)
@@ -54,9 +56,9 @@ Loading::Loading (BoundChemical& loader, const LoadingTable& table)
 }
 
 DoubleStrandLoading::DoubleStrandLoading (BoundChemical& loader, 
-					  const LoadingTable& table,
+					  LoadingTable& table,
 					  BoundChemical& stalled_form)
-  : Loading (loader, table)
+  : Loading (loader, table, DOUBLE_STRAND_LOADING)
   , _stalled_form (stalled_form)
 {}
  
@@ -139,9 +141,9 @@ void DoubleStrandLoading::do_reaction (void)
 
 void Loading::load_chemical (BoundUnit& unit)
 {
-  int template_index =  _table.template_index 
-    (unit.location().sequence().substr 
-     (unit.reading_frame(), _table.template_length()));
+  _table.index_sequence (unit.location());
+  int template_index = _table.template_index 
+    (unit.location(), unit.reading_frame());
   _loader.remove (unit);
   _table.chemical_to_load (template_index).remove (1);
   _table.occupied_state (template_index).add (unit);
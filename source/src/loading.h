@@ -55,8 +55,9 @@ public:
    * @brief Constructor
    * @param loader BoundChemical performing loading operation.
    * @param table LoadingTable used by the loader.
+   * @param type Concrete type of the loading reaction.
    */
-  Loading (BoundChemical& loader, const LoadingTable& table);
+  Loading (BoundChemical& loader, LoadingTable& table, Type type);
 
  private:
   /** @brief Copy constructor */
@@ -111,6 +112,9 @@ public:
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // redefined from Reaction
   void do_reaction (void);
   double compute_rate (void) const;
@@ -121,7 +125,7 @@ public:
   // ============
   //
   /** @brief LoadingTable used by the loader. */
-  const LoadingTable& _table;    
+  LoadingTable& _table;    
 
   /** @brief Filter organizing loader units according to templates. */
   TemplateFilter _template_filter;  
@@ -144,8 +148,8 @@ class ProductLoading : public Loading
    * @param loader BoundChemical performing loading operation.
    * @param table LoadingTable used by the loader.
    */
-  ProductLoading (BoundChemical& loader, const LoadingTable& table)
-    : Loading (loader, table)
+  ProductLoading (BoundChemical& loader, LoadingTable& table)
+    : Loading (loader, table, PRODUCT_LOADING)
     {}
 };
 
@@ -166,10 +170,13 @@ class DoubleStrandLoading: public Loading
    * @param stalled_form BoundChemical appearing if loading failed because
    *  it met a previously polymerized strand.
    */
-  DoubleStrandLoading (BoundChemical& loader, const LoadingTable& table, 
+  DoubleStrandLoading (BoundChemical& loader, LoadingTable& table, 
 		       BoundChemical& stalled_form);
 
  private:
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // redefined from Loading
   void do_reaction (void);
 
@@ -30,11 +30,14 @@
 // ==================
 //
 #include "loadingtable.h"
+#include "chemicalsequence.h"
 
 // ==========================
 //  Constructors/Destructors
 // ==========================
 //
+const int LoadingTable::UNKNOWN_TEMPLATE;
+
 LoadingTable::LoadingTable (const std::vector <std::string>& templates,
 			    const std::vector <FreeChemical*>& chemicals_to_load,
 			    const std::vector <BoundChemical*>& occupied_states,
@@ -71,6 +74,19 @@ LoadingTable::LoadingTable (const std::vector <std::string>& templates,
 //  Public Methods - Commands
 // ===========================
 //
+void LoadingTable::index_sequence (const ChemicalSequence& sequence)
+{
+  if (sequence.id() >= int (_template_codes.size()))
+    { _template_codes.resize (sequence.id() + 1); }
+  std::vector <int>& codes = _template_codes [sequence.id()];
+  if (!codes.empty()) { return; }
+
+  // templates starting too close to the end of the sequence are unknown
+  const std::string& letters = sequence.sequence();
+  codes.assign (letters.size() + 1, UNKNOWN_TEMPLATE);
+  for (int i = 0; i + _template_length <= letters.size(); ++i)
+    { codes [i] = template_index (letters.substr (i, _template_length)); }
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -83,6 +83,15 @@ class LoadingTable : public SimulatorInput
   //  Public Methods - Commands
   // ===========================
   //
+  /**
+   * @brief Compute indices of templates read at every position of a
+   *  sequence.
+   * @param sequence Sequence to read.
+   * @details Indices are stored under the sequence identifier, so that
+   *  later calls to template_index (sequence, position) are a plain array
+   *  read. Calling the method again on the same sequence does nothing.
+   */
+  void index_sequence (const ChemicalSequence& sequence);
 
   // ============================
   //  Public Methods - Accessors
@@ -102,6 +111,18 @@ class LoadingTable : public SimulatorInput
    */
   int template_index (const std::string& template_) const;
 
+  /**
+   * @brief Get index of template read at a given position of a sequence.
+   * @param sequence Sequence read.
+   * @param position Position of the first letter of the template in the 
+   *  sequence string.
+   * @return Index given to the template. LoadingTable::UNKNOWN_TEMPLATE 
+   *  if unknown.
+   * @details Sequence must have been indexed with index_sequence()
+   *  beforehand, otherwise UNKNOWN_TEMPLATE is returned.
+   */
+  int template_index (const ChemicalSequence& sequence, int position) const;
+
   /**
    * @brief Get chemical to load ont the template.
    * @param template_index Template index.
@@ -190,12 +211,19 @@ private:
 
   /** @brief Template length. */
   int _template_length;
+
+  /** 
+   * @brief Template indices per position, indexed by sequence identifier
+   *  (empty for sequences that were not indexed).
+   */
+  std::vector <std::vector <int> > _template_codes;
 };
 
 // ======================
 //  Inline declarations
 // ======================
 //
+#include "chemicalsequence.h" // ChemicalSequence::id
 
 inline int LoadingTable::template_index (const std::string& template_) const
 {
@@ -205,6 +233,22 @@ inline int LoadingTable::template_index (const std::string& template_) const
   else { return UNKNOWN_TEMPLATE; }
 }
 
+inline int LoadingTable::template_index (const ChemicalSequence& sequence,
+					 int position) const
+{
+  /** @pre Sequence must have been indexed. */
+  REQUIRE ((sequence.id() < int (_template_codes.size()))
+	   && !_template_codes [sequence.id()].empty());
+  /** @pre Position must be nonnegative. */
+  REQUIRE (position >= 0);
+  // unindexed sequences and positions past the end read no template
+  if (sequence.id() >= int (_template_codes.size())) 
+    { return UNKNOWN_TEMPLATE; }
+  const std::vector <int>& codes = _template_codes [sequence.id()];
+  if (position >= int (codes.size())) { return UNKNOWN_TEMPLATE; }
+  return codes [position];
+}
+
 inline FreeChemical& LoadingTable::chemical_to_load (int template_index) const
 {
   /** @pre Template index must be nonnegative. */
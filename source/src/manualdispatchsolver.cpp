@@ -21,6 +21,9 @@
 // ==================
 //
 #include <iostream>
+#include <algorithm> // std::max
+#include <map> // std::map
+#include <cmath> // sqrt
 
 // ==================
 //  Project Includes
@@ -30,43 +33,54 @@
 #include "reactionclassification.h"
 #include "updatedrategroup.h"
 #include "constantrategroup.h"
+#include "simulationparams.h"
+#include "reaction.h"
 
 // ==========================
 //  Constructors/Destructors
 // ==========================
 //
+const double ManualDispatchSolver::SMOOTHING = 0.1;
+const int ManualDispatchSolver::MIN_CHECKS = 10;
+
 ManualDispatchSolver::
 ManualDispatchSolver (const SimulationParams& params, 
 		      const ReactionClassification& classification)
   : Solver (params)
+  , _params (params)
   , _next_reaction (0)
   , _next_reaction_time (NO_REACTION_LEFT)
+  , _variable_event (0)
+  , _tolerance (params.adaptive_tolerance())
+  , _check_step (params.adaptive_time_step())
+  , _next_check (time() + _check_step)
+  , _number_checks (0)
 {
-  int number_groups = classification.number_classes();
-
-  // create a group for every class in the reaction
-  for (int i = 0; i < number_groups; ++i)
+  if (_tolerance > 0)
     {
-      if (classification.time_step (i) 
-	  == ReactionClassification::ALWAYS_UPDATED())
+      // store reactions along with the time step to use when their rate is
+      // considered constant
+      for (int i = 0; i < classification.number_classes(); ++i)
 	{
-	  // if rates are always updated, we use UpdatedRateGroup
-	  _updated_rate_groups.push_back 
-	    (new UpdatedRateGroup (params, classification.reactions (i),
-				   time()));
-	}
-      else
-	{
-	  // else we use ConstantRateGroup with the provided time step
-	  ConstantRateGroup* group = 
-	    new ConstantRateGroup (params, classification.reactions (i), 
-				   time(), classification.time_step(i));
-	  _constant_rate_groups.push_back (group);
-	  // schedule event
-	  insert_event (group->next_reaction_time(), group);
+	  bool always_updated = (classification.time_step (i) 
+				 == ReactionClassification::ALWAYS_UPDATED());
+	  const std::vector <Reaction*>& reactions
+	    = classification.reactions (i);
+	  for (std::size_t j = 0; j < reactions.size(); ++j)
+	    {
+	      _reactions.push_back (reactions [j]);
+	      _always_updated.push_back (always_updated);
+	      _constant_time_steps.push_back 
+		(always_updated ? _check_step : classification.time_step (i));
+	      reactions [j]->update_rate();
+	      _last_rates.push_back (reactions [j]->rate());
+	    }
 	}
+      _rate_variations.assign (_reactions.size(), 0);
     }
-  schedule_next_reaction();
+
+  create_groups (classification);
+  find_next_reaction();
 }
 
 // Forbidden
@@ -75,11 +89,7 @@ ManualDispatchSolver (const SimulationParams& params,
 
 ManualDispatchSolver::~ManualDispatchSolver (void)
 {  
-  // delete all allocated reaction groups
-  for (std::size_t i = 0; i < _constant_rate_groups.size(); ++i)
-    { delete _constant_rate_groups [i]; }
-  for (std::size_t i = 0; i < _updated_rate_groups.size(); ++i)
-    { delete _updated_rate_groups [i]; }
+  delete_groups();
 }
 
 // ===========================
@@ -88,28 +98,28 @@ ManualDispatchSolver::~ManualDispatchSolver (void)
 //
 void ManualDispatchSolver::schedule_next_reaction (void)
 {
+  // if groups were rebuilt, all events were rescheduled from current time
+  if ((_tolerance > 0) && (time() >= _next_check) && adapt_classification())
+    { find_next_reaction(); return; }
+
   // pop previous reaction and replace it if necessary
-  if (_event_list.front().group != _variable_event.group) 
-    { update_first_event(); }
+  if (_event_times.top_index() != _variable_event) { update_first_event(); }
 
   // update events generated by variable rate groups
   update_variable_event();
 
-  // depending on reactant availability, we may need to go through several 
-  // reactions before we find a reaction that can actually be performed
-  // correctly
-  bool reaction_found = false;
-  while (reaction_found == false)
+  find_next_reaction();
+}
+
+void ManualDispatchSolver::reshape_rates (void)
+{
+  // constant rate groups draw from alias tables, only updated rate groups
+  // hold reorganizable containers
+  for (std::vector <UpdatedRateGroup*>::iterator 
+	 it = _updated_rate_groups.begin();
+       it != _updated_rate_groups.end(); ++it)
     {
-      // _next_reaction can be 0 if a group reached the limit of its time step
-      // scheduling a new reaction in the group will trigger its update
-      _next_reaction = _event_list.front().group->next_reaction();
-      if ((_next_reaction != 0) && (_next_reaction->is_reaction_possible()))
-	{
-	  _next_reaction_time = _event_list.front().time;
-	  reaction_found = true;
-	}
-      else { update_first_event(); }
+      (*it)->reshape_rates();
     }
 }
 
@@ -125,13 +135,10 @@ void ManualDispatchSolver::schedule_next_reaction (void)
 void ManualDispatchSolver::reinitialize (void)
 {
   // we reinitialize and reschedule all constant rate events
-  _event_list.clear();
-  for (std::vector <ConstantRateGroup*>::iterator 
-	 it = _constant_rate_groups.begin();
-       it != _constant_rate_groups.end(); ++it)
+  for (std::size_t i = 0; i < _constant_rate_groups.size(); ++i)
     {
-      (*it)->reinitialize (time());
-      insert_event ((*it)->next_reaction_time(), *it);
+      _constant_rate_groups [i]->reinitialize (time());
+      _event_times.update (i, _constant_rate_groups [i]->next_reaction_time());
     }
 
   // we reinitialize updated rate groups
@@ -141,45 +148,202 @@ void ManualDispatchSolver::reinitialize (void)
     {
       (*it)->reinitialize (time());
     }
+  update_variable_event();
+
+  find_next_reaction();
 }
 
-void ManualDispatchSolver::update_first_event (void)
+void ManualDispatchSolver::find_next_reaction (void)
 {
-  ReactionGroup* group = _event_list.front().group;
-  _event_list.pop_front();
-  group->schedule_next_reaction (time());
-  insert_event (group->next_reaction_time(), group);
+  // depending on reactant availability, we may need to go through several 
+  // reactions before we find a reaction that can actually be performed
+  // correctly
+  bool reaction_found = false;
+  while (reaction_found == false)
+    {
+      if (_event_times.top_value() == NO_REACTION_LEFT)
+	{
+	  std::cerr << "Warning: no reactions left to perform "
+		    << "(t = " << time() << ")." << std::endl;
+	  _next_reaction = 0;
+	  _next_reaction_time = NO_REACTION_LEFT;
+	  return;
+	}
+
+      // _next_reaction can be 0 if a group reached the limit of its time step
+      // scheduling a new reaction in the group will trigger its update
+      _next_reaction = _event_groups [_event_times.top_index()]->next_reaction();
+      if ((_next_reaction != 0) && (_next_reaction->is_reaction_possible()))
+	{
+	  _next_reaction_time = _event_times.top_value();
+	  reaction_found = true;
+	}
+      else { update_first_event(); }
+    }
 }
 
-void ManualDispatchSolver::insert_event (double time, ReactionGroup* group)
+void ManualDispatchSolver::update_first_event (void)
 {
-  // insert event at its right position in the list (sorted by event time)
-  std::list <GroupEvent>::iterator it = _event_list.begin();
-  while ((it != _event_list.end()) && (it->time < time)) { ++it; }
-  _event_list.insert (it, GroupEvent (time, group));
+  // groups are rescheduled from the time of their event, so that groups
+  // reaching the end of their time step are updated at the right time
+  int event = _event_times.top_index();
+  ReactionGroup* group = _event_groups [event];
+  group->schedule_next_reaction (_event_times.top_value());
+  if (event == _variable_event) { find_variable_event(); }
+  else { _event_times.update (event, group->next_reaction_time()); }
 }
 
 void ManualDispatchSolver::update_variable_event (void)
 {
-  // remove previous event if necessary
-  std::list <GroupEvent>::iterator it = _event_list.begin();
-  while ((it != _event_list.end()) && (it->group != _variable_event.group)) 
-    { ++it; }
-  if (it != _event_list.end()) { _event_list.erase (it); }
-  
   // we update variable rate groups and keep an event for the next reaction
-  _variable_event.time = NO_REACTION_LEFT;
   for (std::vector <UpdatedRateGroup*>::iterator 
 	 it = _updated_rate_groups.begin();
        it != _updated_rate_groups.end(); ++it)
     {
       (*it)->schedule_next_reaction (time());
-      if ((*it)->next_reaction_time() < _variable_event.time)
+    }
+  find_variable_event();
+}
+
+void ManualDispatchSolver::find_variable_event (void)
+{
+  double variable_time = NO_REACTION_LEFT;
+  for (std::vector <UpdatedRateGroup*>::iterator 
+	 it = _updated_rate_groups.begin();
+       it != _updated_rate_groups.end(); ++it)
+    {
+      if ((*it)->next_reaction_time() < variable_time)
+	{
+	  _event_groups [_variable_event] = *it;
+	  variable_time = (*it)->next_reaction_time();
+	}
+    }
+  _event_times.update (_variable_event, variable_time);
+}
+
+void ManualDispatchSolver::
+create_groups (const ReactionClassification& classification)
+{
+  int number_groups = classification.number_classes();
+
+  // create a group for every class in the reaction
+  for (int i = 0; i < number_groups; ++i)
+    {
+      if (classification.time_step (i) 
+	  == ReactionClassification::ALWAYS_UPDATED())
+	{
+	  // if rates are always updated, we use UpdatedRateGroup
+	  _updated_rate_groups.push_back 
+	    (new UpdatedRateGroup (_params, classification.reactions (i),
+				   time()));
+	}
+      else
+	{
+	  // else we use ConstantRateGroup with the provided time step
+	  ConstantRateGroup* group = 
+	    new ConstantRateGroup (_params, classification.reactions (i), 
+				   time(), classification.time_step(i));
+	  _constant_rate_groups.push_back (group);
+	  // schedule event
+	  _event_groups.push_back (group);
+	  _event_times.push (group->next_reaction_time());
+	}
+    }
+
+  // last event is generated by updated rate groups
+  _variable_event = _event_times.push (NO_REACTION_LEFT);
+  _event_groups.push_back (0);
+  update_variable_event();
+}
+
+void ManualDispatchSolver::delete_groups (void)
+{
+  // delete all allocated reaction groups
+  for (std::size_t i = 0; i < _constant_rate_groups.size(); ++i)
+    { delete _constant_rate_groups [i]; }
+  for (std::size_t i = 0; i < _updated_rate_groups.size(); ++i)
+    { delete _updated_rate_groups [i]; }
+  _constant_rate_groups.clear();
+  _updated_rate_groups.clear();
+  _event_groups.clear();
+  _event_times = IndexedPriorityQueue <double>();
+}
+
+bool ManualDispatchSolver::adapt_classification (void)
+{
+  // sample rates and update moving average of squared relative variation
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    {
+      _reactions [i]->update_rate();
+      double rate = _reactions [i]->rate();
+      double reference = std::max (rate, _last_rates [i]);
+      double variation = 0;
+      if (reference > 0) { variation = (rate - _last_rates [i]) / reference; }
+      if (_number_checks == 0) { _rate_variations [i] = variation*variation; }
+      else 
+	{ 
+	  _rate_variations [i] += 
+	    SMOOTHING * (variation*variation - _rate_variations [i]);
+	}
+      _last_rates [i] = rate;
+    }
+  ++_number_checks;
+  while (_next_check <= time()) { _next_check += _check_step; }
+  if (_number_checks < MIN_CHECKS) { return false; }
+
+  // estimated error is the variation cumulated over a constant time step,
+  // half the tolerance is required to leave the always updated group so that
+  // reactions do not oscillate between groups
+  bool dispatch_changed = false;
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    {
+      double error = sqrt (_rate_variations [i]) 
+	* _constant_time_steps [i] / _check_step;
+      if ((_always_updated [i] && (error <= 0.5*_tolerance))
+	  || (!_always_updated [i] && (error > _tolerance)))
 	{
-	  _variable_event.group = *it;
-	  _variable_event.time = (*it)->next_reaction_time();
+	  _always_updated [i] = !_always_updated [i];
+	  dispatch_changed = true;
 	}
     }
-  insert_event (_variable_event.time, _variable_event.group);
+  if (dispatch_changed) { rebuild_groups(); }
+  return dispatch_changed;
 }
 
+void ManualDispatchSolver::rebuild_groups (void)
+{
+  // constant reactions sharing the same time step end up in the same class
+  ReactionClassification classification;
+  std::map <double, int> constant_ids;
+  int always_updated_id = -1;
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    {
+      int class_id = 0;
+      if (_always_updated [i])
+	{
+	  if (always_updated_id == -1)
+	    {
+	      always_updated_id = classification.create_new_class 
+		(ReactionClassification::ALWAYS_UPDATED());
+	    }
+	  class_id = always_updated_id;
+	}
+      else
+	{
+	  std::map <double, int>::iterator 
+	    id_it = constant_ids.find (_constant_time_steps [i]);
+	  if (id_it == constant_ids.end())
+	    {
+	      id_it = constant_ids.insert 
+		(std::make_pair (_constant_time_steps [i], classification.
+				 create_new_class (_constant_time_steps [i])))
+		.first;
+	    }
+	  class_id = id_it->second;
+	}
+      classification.add_reaction_to_class (class_id, *_reactions [i]);
+    }
+
+  delete_groups();
+  create_groups (classification);
+}
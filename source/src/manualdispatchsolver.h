@@ -25,7 +25,7 @@
 //  General Includes
 // ==================
 //
-#include <list> // std::list
+#include <vector> // std::vector
 
 // ==================
 //  Project Includes
@@ -33,13 +33,26 @@
 //
 #include "forwarddeclarations.h"
 #include "solver.h"
+#include "indexedpriorityqueue.h"
 
 /**
  * @brief Class integrating reactions with user-defined groups and time steps.
  *
  * ManualDispatchSolver integrates a system of reactions according to a user-
  * specified classification. This classification defines when rates should be
- * updated, allowing for efficient scheduling of reaction times.
+ * updated, allowing for efficient scheduling of reaction times. Events
+ * generated by the different groups are stored in an IndexedPriorityQueue, so
+ * that handling an event costs O(logG), where G is the number of groups.
+ *
+ * If an adaptive tolerance is given in the simulation parameters, the
+ * classification only defines the initial dispatch of reactions. Rates are
+ * sampled at regular time intervals and a moving average of their relative
+ * variation between samples is used to estimate the error made by considering
+ * them constant during the time step of their class. Reactions whose
+ * estimated error exceeds the tolerance are moved to UpdatedRateGroup,
+ * always updated reactions whose estimated error falls below half the
+ * tolerance are moved back to a ConstantRateGroup (reactions that were
+ * initially always updated use the adaptive time step).
  * This class inherits class Solver.
  * @sa ConstantRateGroup
  * @sa UpdatedRateGroup
@@ -78,6 +91,8 @@ class ManualDispatchSolver : public Solver
   //  Public Methods - Commands
   // ===========================
   //
+  // Redefined from Solver
+  void reshape_rates (void);
 
   // ============================
   //  Public Methods - Accessors
@@ -87,7 +102,6 @@ class ManualDispatchSolver : public Solver
   double next_reaction_time (void) const;
 
 private:
-  /** @brief Struct storing next scheduled event. */
   // =================
   //  Private Methods
   // =================
@@ -98,14 +112,12 @@ private:
   Reaction& next_reaction (void) const;
   
   /**
-   * @brief Insert event in event list.
-   * @param time Time of event.
-   * @param group Pointer to group performing event.
+   * @brief Find first event corresponding to a reaction that can be performed.
    */
-  void insert_event (double time, ReactionGroup* group);
+  void find_next_reaction (void);
 
   /**
-   * @brief Update first envent in event list.
+   * @brief Reschedule group generating first event and update event queue.
    */
   void update_first_event (void);
 
@@ -114,10 +126,42 @@ private:
    */
   void update_variable_event (void);
 
+  /**
+   * @brief Store first reaction among UpdatedRateGroup in event queue.
+   */
+  void find_variable_event (void);
+
+  /**
+   * @brief Create reaction groups and schedule their events.
+   * @param classification Classification specifying how reactions should be
+   *  integrated.
+   */
+  void create_groups (const ReactionClassification& classification);
+
+  /**
+   * @brief Delete reaction groups and clear event queue.
+   */
+  void delete_groups (void);
+
+  /**
+   * @brief Sample rates and move reactions between constant and updated
+   *  rate groups according to their variation.
+   * @return True if groups were rebuilt (and events rescheduled).
+   */
+  bool adapt_classification (void);
+
+  /**
+   * @brief Rebuild groups according to current dispatch of reactions.
+   */
+  void rebuild_groups (void);
+
   // ============
   //  Attributes
   // ============
   //
+  /** @brief Simulation parameters used to create groups. */
+  const SimulationParams& _params;
+
   /** @brief Next reaction. */
   Reaction* _next_reaction;
 
@@ -130,19 +174,54 @@ private:
   /** @brief Vector of groups to update after every reaction. */
   std::vector <UpdatedRateGroup*> _updated_rate_groups;
 
-  struct GroupEvent 
-  {
-    GroupEvent (double time = 0, ReactionGroup* group = 0)
-    : time (time), group (group) {}
-    double time;
-    ReactionGroup* group;
-  };
+  /**
+   * @brief Groups generating events (constant rate groups followed by the
+   *  UpdatedRateGroup whose reaction comes first).
+   */
+  std::vector <ReactionGroup*> _event_groups;
+
+  /** @brief Time of next event (reaction or group update) of every group. */
+  IndexedPriorityQueue <double> _event_times;
+
+  /** @brief Index of the event generated by UpdatedRateGroups. */
+  int _variable_event;
+
+  /** @brief Maximal relative rate error (0 if classification is fixed). */
+  double _tolerance;
+
+  /** @brief Time interval between two rate samples. */
+  double _check_step;
 
-  /** @brief List of events (reaction or group update) sorted by time. */
-  std::list <GroupEvent> _event_list;
+  /** @brief Time of next rate sample. */
+  double _next_check;
+
+  /** @brief Number of rate samples performed. */
+  int _number_checks;
+
+  /** @brief Reactions whose dispatch may be adapted. */
+  std::vector <Reaction*> _reactions;
+
+  /** @brief Time step to use for every reaction when considered constant. */
+  std::vector <double> _constant_time_steps;
+
+  /** @brief Whether every reaction currently belongs to UpdatedRateGroup. */
+  std::vector <bool> _always_updated;
+
+  /** @brief Rate of every reaction at last sample. */
+  std::vector <double> _last_rates;
+
+  /** @brief Moving average of squared relative rate variation. */
+  std::vector <double> _rate_variations;
+
+  // ===================
+  //  Private Constants
+  // ===================
+  //
+  /** @brief Weight of last sample in moving average of rate variations. */
+  static const double SMOOTHING;
 
-  /** @brief Event for the next UpdatedRateGroup that triggers. */
-  GroupEvent _variable_event;
+  /** @brief Number of samples needed before reactions can be moved. */
+  static const int MIN_CHECKS;
 };
 
 // ======================
@@ -41,6 +41,13 @@ NaiveRateManager::NaiveRateManager (const SimulationParams& params,
 {
 }
 
+NaiveRateManager::NaiveRateManager (const SimulationParams& params,
+				    const std::vector <Reaction*>& reactions,
+				    const RateContainerFactory& factory)
+  : RateManager (params, reactions, factory)
+{
+}
+
 // Not needed for this class (use of compiler generated versions)
 // NaiveRateManager::NaiveRateManager (const NaiveRateManager& other_manager);
 // NaiveRateManager& NaiveRateManager::operator= (const NaiveRateManager& other_manager);
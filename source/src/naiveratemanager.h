@@ -61,6 +61,16 @@ class NaiveRateManager : public RateManager
   NaiveRateManager (const SimulationParams& params,
 		    const std::vector <Reaction*>& reactions);
 
+  /**
+   * @brief Constructor with specific rate container.
+   * @param params Simulation parameters.
+   * @param reactions Vector of reactions whose rates need to be stored and updated.
+   * @param factory Factory used to create the rate container.
+   */
+  NaiveRateManager (const SimulationParams& params,
+		    const std::vector <Reaction*>& reactions,
+		    const RateContainerFactory& factory);
+
   // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
   // /* @brief Copy constructor. */
@@ -65,6 +65,10 @@ NaiveSolver::~NaiveSolver (void)
 //  Public Methods - Commands
 // ===========================
 //
+void NaiveSolver::reshape_rates (void)
+{
+  _rate_manager->reshape_rates();
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -79,6 +79,8 @@ class NaiveSolver : public Solver
   //  Public Methods - Commands
   // ===========================
   //
+  // Redefined from Solver
+  void reshape_rates (void);
 
   // ============================
   //  Public Methods - Accessors
@@ -0,0 +1,138 @@
+//
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+//
+//
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+
+/**
+ * @file nextreactionsolver.cpp
+ * @brief Implementation of the NextReactionSolver class.
+ *
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <iostream> // std::cerr
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "macros.h" // REQUIRE() ENSURE()
+#include "nextreactionsolver.h"
+#include "reaction.h"
+#include "randomhandler.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+NextReactionSolver::NextReactionSolver (const SimulationParams& params,
+					const std::vector <Reaction*>& reactions)
+  : Solver (params)
+  , _reactions (reactions)
+  , _rates (reactions.size(), 0)
+  , _reaction_times (reactions.size(), NO_REACTION_LEFT)
+  , _rate_validity (reactions.size())
+{
+  // compile reactant to reaction dependencies and attach observers
+  _rate_validity.watch (_reactions);
+  reinitialize();
+}
+
+// Forbidden
+// NextReactionSolver::NextReactionSolver (const NextReactionSolver& other_solver);
+// NextReactionSolver& NextReactionSolver::operator= (const NextReactionSolver& other_solver);
+// NextReactionSolver::~NextReactionSolver (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+
+
+// =================
+//  Private Methods
+// =================
+//
+void NextReactionSolver::schedule_next_reaction (void)
+{
+  // the reaction that was just performed is still on top of the queue
+  int performed = _reaction_times.top_index();
+
+  // rescale firing times of reactions whose rate may have changed
+  while (!_rate_validity.empty())
+    {
+      _update_reaction (_rate_validity.front());
+      _rate_validity.pop();
+    }
+
+  // the reaction that was just performed needs a new firing time
+  _reactions [performed]->update_rate();
+  _rates [performed] = _reactions [performed]->rate();
+  _reaction_times.update (performed, _draw_reaction_time (performed));
+
+  if (next_reaction_time() == NO_REACTION_LEFT)
+    {
+      std::cerr << "Warning: no reactions left to perform "
+		<< "(t = " << time() << ")." << std::endl;
+    }
+}
+
+void NextReactionSolver::reinitialize (void)
+{
+  // rates may have changed without notification (e.g. volume change), so we
+  // recompute everything and draw new firing times
+  _rate_validity.clear();
+  std::vector <double> reaction_times (_reactions.size());
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    {
+      _reactions [i]->update_rate();
+      _rates [i] = _reactions [i]->rate();
+      reaction_times [i] = _draw_reaction_time (i);
+    }
+  _reaction_times.assign (reaction_times);
+}
+
+void NextReactionSolver::_update_reaction (int index)
+{
+  double old_rate = _rates [index];
+  _reactions [index]->update_rate();
+  double new_rate = _reactions [index]->rate();
+  if (new_rate == old_rate) { return; }
+  _rates [index] = new_rate;
+
+  if (new_rate == 0)
+    { _reaction_times.update (index, NO_REACTION_LEFT); }
+  else if (old_rate == 0)
+    { _reaction_times.update (index, _draw_reaction_time (index)); }
+  else
+    {
+      // reuse remaining waiting time (Gibson & Bruck)
+      _reaction_times.update
+	(index, time() + (old_rate/new_rate)
+	 * (_reaction_times [index] - time()));
+    }
+}
+
+double NextReactionSolver::_draw_reaction_time (int index) const
+{
+  if (_rates [index] == 0) { return NO_REACTION_LEFT; }
+  return time() + RandomHandler::instance().draw_exponential (_rates [index]);
+}
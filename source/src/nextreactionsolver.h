@@ -0,0 +1,154 @@
+//
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+//
+//
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+
+/**
+ * @file nextreactionsolver.h
+ * @brief Header for the NextReactionSolver class.
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef NEXT_REACTION_SOLVER_H
+#define NEXT_REACTION_SOLVER_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "forwarddeclarations.h"
+#include "solver.h"
+#include "ratevalidity.h"
+#include "indexedpriorityqueue.h"
+
+/**
+ * @brief NextReactionSolver class for integrating reactions according to the
+ *  Next Reaction Method of Gibson and Bruck.
+ *
+ * The NextReactionSolver class stores a putative firing time for every
+ * reaction in an IndexedPriorityQueue. The next reaction is the one with the
+ * smallest firing time. Like DependencyRateManager, it attaches itself to the
+ * reactants of every reaction, so that only reactions whose rate may have
+ * changed are recomputed after a reaction. Their firing times are rescaled
+ * rather than redrawn, so that a single random number is drawn per step
+ * (for the reaction that was just performed). Each step costs O(logN), where
+ * N is the number of reactions.
+ * This class inherits class Solver.
+ */
+class NextReactionSolver : public Solver
+{
+ public:
+
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Default constructor
+   * @param params Simulation parameters.
+   * @param reactions Vector of reactions to integrate.
+   */
+  NextReactionSolver (const SimulationParams& params,
+		      const std::vector <Reaction*>& reactions);
+
+ private:
+  // Forbidden
+  /** @brief Copy constructor. */
+  NextReactionSolver (const NextReactionSolver& other_solver);
+  /** @brief Assignment operator. */
+  NextReactionSolver& operator= (const NextReactionSolver& other_solver);
+
+ public:
+  // Not needed for this class (use of compiler-generated versions)
+  // /* @brief Destructor. */
+  // ~NextReactionSolver (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  // Redefined from Solver
+  double next_reaction_time (void) const;
+
+private:
+  // =================
+  //  Private Methods
+  // =================
+  //
+  // Redefined from Solver
+  void schedule_next_reaction (void);
+  void reinitialize (void);
+  Reaction& next_reaction (void) const;
+
+  /**
+   * @brief Recompute rate of a reaction and rescale its firing time.
+   * @param index Index of the reaction in the reaction vector.
+   */
+  void _update_reaction (int index);
+
+  /**
+   * @brief Draw a new firing time for a reaction from its current rate.
+   * @param index Index of the reaction in the reaction vector.
+   * @return Firing time (NO_REACTION_LEFT if rate is zero).
+   */
+  double _draw_reaction_time (int index) const;
+
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Reactions integrated by the solver. */
+  std::vector <Reaction*> _reactions;
+
+  /** @brief Rates used to compute current firing times. */
+  std::vector <double> _rates;
+
+  /** @brief Putative firing time of every reaction. */
+  IndexedPriorityQueue <double> _reaction_times;
+
+  /** @brief Container storing indices of reactions to update. */
+  RateValidity _rate_validity;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h" // REQUIRE
+
+inline double NextReactionSolver::next_reaction_time (void) const
+{
+  if (_reaction_times.size() == 0) { return NO_REACTION_LEFT; }
+  return _reaction_times.top_value();
+}
+
+inline Reaction& NextReactionSolver::next_reaction (void) const
+{
+  /** @pre A reaction must be scheduled (i.e. next reaction time is finite). */
+  REQUIRE (next_reaction_time() != NO_REACTION_LEFT);
+  return *(_reactions [_reaction_times.top_index()]);
+}
+
+#endif // NEXT_REACTION_SOLVER_H
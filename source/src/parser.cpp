@@ -89,7 +89,6 @@ void Parser::parse (InputData& input_data)
   // we loop through the data until no creation takes place anymore
   // the idea is that as long as dependencies may not have been resolved
   // we need to try to create everything again
-  std::cout << "Parsing data..." << std::endl;
   bool entity_created = true;
   bool display_dependency_errors = false;
   bool dependency_errors = false;
@@ -35,7 +35,6 @@
 PartialStrand::PartialStrand (int length)
   : _length (length)
   , _number_occupied (0)
-  , _occupied (length, false)
 {
 }
 
@@ -47,6 +46,28 @@ PartialStrand::PartialStrand (int length)
 //  Public Methods - Commands
 // ===========================
 //
+void PartialStrand::occupy (int position)
+{
+  /** @pre Position must not be occupied already. */
+  REQUIRE (occupied (position) == false);
+
+  // segments ending just before and starting just after position
+  std::map <int, int>::iterator next = _segments.upper_bound (position);
+  bool merge_next = ((next != _segments.end()) 
+		     && (next->first == position+1));
+  std::map <int, int>::iterator previous = next;
+  bool merge_previous = ((next != _segments.begin())
+			 && ((--previous)->second == position-1));
+
+  int last = merge_next ? next->second : position;
+  if (merge_next) { _segments.erase (next); }
+  if (merge_previous) { previous->second = last; }
+  else { _segments [position] = last; }
+  ++_number_occupied;
+
+  /** @post Number of position occupied should be reasonable. */
+  ENSURE ((_number_occupied > 0) && (_number_occupied <= _length));
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -56,15 +77,13 @@ PartialStrand::PartialStrand (int length)
 std::vector <int> PartialStrand::segments (void) const
 {
   std::vector <int> result;
-  if (_occupied [0]) { result.push_back (0); }
-  for (int i = 1; i < _length; ++i)
+  result.reserve (2*_segments.size());
+  for (std::map <int, int>::const_iterator segment_it = _segments.begin();
+       segment_it != _segments.end(); ++segment_it)
     {
-      // detect beginning of segment
-      if (_occupied [i] && !(_occupied [i-1])) { result.push_back (i); }
-      // detect end of segment
-      if (!(_occupied [i]) && _occupied [i-1]) { result.push_back (i-1); }
+      result.push_back (segment_it->first);
+      result.push_back (segment_it->second);
     }
-  if (_occupied [_length-1]) { result.push_back (_length-1); }
   /** @post Length of result must be a multiple of 2. */
   ENSURE (result.size() % 2 == 0);
   return result;
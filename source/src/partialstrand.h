@@ -26,6 +26,7 @@
 // ==================
 //
 #include <vector> // std::vector
+#include <map> // std::map
 
 // ==================
 //  Project Includes
@@ -41,6 +42,12 @@
 
 /**
  * @brief Class representing a strand composed of subsegments.
+ *
+ * PartialStrand stores its segments sorted by first position, adjacent
+ * segments being merged as positions get occupied. Memory and the cost of
+ * resetting the strand or exporting its segments are O(S), where S is the
+ * number of segments, instead of O(L), where L is the length of the strand.
+ * Occupying or checking a position is O(logS).
  */
 class PartialStrand
 {
@@ -120,30 +127,19 @@ private:
   int _length;
   /** @brief Number of bases currently occupied. */
   int _number_occupied;
-  /** @brief List of sequence segments. */
-  std::vector <bool> _occupied;
+  /** @brief Last position of segments, indexed by their first position. */
+  std::map <int, int> _segments;
 };
 
 // ======================
 //  Inline declarations
 // ======================
 //
-#include <algorithm> // std::fill
 #include "macros.h"
 
-inline void PartialStrand::occupy (int position)
-{
-  /** @pre Position must not be occupied already. */
-  REQUIRE (_occupied [position] == false);
-  _occupied [position] = true;
-  ++_number_occupied;
-  /** @post Number of position occupied should be reasonable. */
-  ENSURE ((_number_occupied > 0) && (_number_occupied <= _length));
-}
-
 inline void PartialStrand::reset (void)
 {
-  std::fill (_occupied.begin(), _occupied.end(), false);
+  _segments.clear();
   _number_occupied = 0;
 }
 
@@ -159,7 +155,14 @@ inline bool PartialStrand::empty (void) const
 
 inline bool PartialStrand::occupied (int position) const
 {
-  return _occupied [position];
+  /** @pre Position must be within strand. */
+  REQUIRE ((position >= 0) && (position < _length));
+  // look for the last segment starting at or before position
+  std::map <int, int>::const_iterator segment_it = 
+    _segments.upper_bound (position);
+  if (segment_it == _segments.begin()) { return false; }
+  --segment_it;
+  return (segment_it->second >= position);
 }
 
 
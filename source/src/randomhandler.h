@@ -115,6 +115,15 @@ class RandomHandler
    */ 
   double draw_exponential (double lambda);
 
+  /**
+   * @brief Draw a real value from an Erlang distribution.
+   * @return Random non-negative double, distributed as the sum of shape
+   *  independent exponential variables of parameter lambda (0 if shape is 0).
+   * @param shape Number of exponential phases.
+   * @param lambda Parameter of every exponential phase.
+   */ 
+  double draw_erlang (int shape, double lambda);
+
   /**
    * @brief Change seed of the random generator.
    * @param seed Integer used to seed the generator.
@@ -245,5 +254,14 @@ inline double RandomHandler::draw_exponential (double lambda)
 #endif // HAVE_BOOST
 }
 
+inline double RandomHandler::draw_erlang (int shape, double lambda)
+{
+  REQUIRE (shape >= 0); /** @pre shape must be positive. */
+  REQUIRE (lambda > 0); /** @pre lambda must be positive. */
+
+  double result = 0;
+  for (int i = 0; i < shape; ++i) { result += draw_exponential (lambda); }
+  return result;
+}
 
 #endif // RANDOMHANDLER_H
@@ -0,0 +1,131 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file rangemaxtree.cpp
+ * @brief Implementation of the RangeMaxTree class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <algorithm> // std::max
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "rangemaxtree.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+RangeMaxTree::RangeMaxTree (int size)
+  : _size (size)
+  , _height (0)
+  , _nodes (2*size, 0)
+  , _pending (size, 0)
+{
+  /** @pre size must be positive. */
+  REQUIRE (size >= 0);
+  while ((size >> _height) != 0) { ++_height; }
+}
+
+// Not needed for this class (use of compiler-generated versions)
+// RangeMaxTree::RangeMaxTree (const RangeMaxTree& other);
+// RangeMaxTree& RangeMaxTree::operator= (const RangeMaxTree& other);
+// RangeMaxTree::~RangeMaxTree (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void RangeMaxTree::add (int first, int last, int value)
+{
+  /** @pre first must be within bounds. */
+  REQUIRE ((first >= 0) && (first < _size));
+  /** @pre last must be within bounds. */
+  REQUIRE ((last >= 0) && (last < _size));
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+
+  // nodes covering [first, last] are found by going up from both ends
+  int left = first + _size;
+  int right = last + 1 + _size;
+  for (int l = left, r = right; l < r; l >>= 1, r >>= 1)
+    {
+      if (l & 1) { apply (l++, value); }
+      if (r & 1) { apply (--r, value); }
+    }
+  build (left);
+  build (right - 1);
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+int RangeMaxTree::max (int first, int last) const
+{
+  /** @pre first must be within bounds. */
+  REQUIRE ((first >= 0) && (first < _size));
+  /** @pre last must be within bounds. */
+  REQUIRE ((last >= 0) && (last < _size));
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+
+  int l = first + _size;
+  int r = last + 1 + _size;
+  push (l);
+  push (r - 1);
+  int result = _nodes [l];
+  for (; l < r; l >>= 1, r >>= 1)
+    {
+      if (l & 1) { result = std::max (result, _nodes [l++]); }
+      if (r & 1) { result = std::max (result, _nodes [--r]); }
+    }
+  return result;
+}
+
+// =================
+//  Private Methods
+// =================
+//
+void RangeMaxTree::build (int node)
+{
+  while (node > 1)
+    {
+      node >>= 1;
+      _nodes [node] = std::max (_nodes [2*node], _nodes [2*node+1])
+	+ _pending [node];
+    }
+}
+
+void RangeMaxTree::push (int node) const
+{
+  for (int shift = _height; shift > 0; --shift)
+    {
+      int ancestor = node >> shift;
+      if (_pending [ancestor] != 0)
+	{
+	  apply (2*ancestor, _pending [ancestor]);
+	  apply (2*ancestor+1, _pending [ancestor]);
+	  _pending [ancestor] = 0;
+	}
+    }
+}
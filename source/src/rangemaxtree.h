@@ -0,0 +1,174 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file rangemaxtree.h
+ * @brief Header for the RangeMaxTree class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef RANGE_MAX_TREE_H
+#define RANGE_MAX_TREE_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+
+/**
+ * @brief Class storing integer values supporting range increments and range
+ *  maximum queries.
+ * 
+ * RangeMaxTree is a segment tree stored bottom-up in a single vector: leaves
+ * hold the values and every internal node holds the maximum of its children
+ * plus a pending increment that applies to its whole subtree. Adding a value
+ * to a range of positions and computing the maximum over a range are both
+ * O(logN) where N is the number of values stored.
+ */
+class RangeMaxTree
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Constructor.
+   * @param size Number of values to store (all initially 0).
+   */
+  RangeMaxTree (int size);
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // RangeMaxTree (const RangeMaxTree& other);
+  // /* @brief Assignment operator. */
+  // RangeMaxTree& operator= (const RangeMaxTree& other);
+  // /* @brief Destructor. */
+  // ~RangeMaxTree (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  /**
+   * @brief Add value to a range of positions.
+   * @param first First position of the range.
+   * @param last Last position of the range.
+   * @param value Value to add to every position within [first, last].
+   */
+  void add (int first, int last, int value);
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  /**
+   * @brief Compute maximum over a range of positions.
+   * @param first First position of the range.
+   * @param last Last position of the range.
+   * @return Largest value stored within [first, last].
+   */
+  int max (int first, int last) const;
+
+  /**
+   * @brief Accessor to value at given position.
+   * @param position Position of interest.
+   * @return Value stored at position.
+   */
+  int operator[] (int position) const;
+
+  /**
+   * @brief Accessor to number of values stored.
+   * @return Number of values stored.
+   */
+  int size (void) const;
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Number of values stored. */
+  int _size;
+
+  /** @brief Height of the tree. */
+  int _height;
+
+  /**
+   * @brief Nodes of the tree (leaves stored after internal nodes): maximum
+   *  of the subtree including increments pending at the node.
+   */
+  mutable std::vector <int> _nodes;
+
+  /** @brief Increments pending at internal nodes. */
+  mutable std::vector <int> _pending;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+  /**
+   * @brief Add value to a whole subtree.
+   * @param node Index of the subtree root.
+   * @param value Value to add.
+   */
+  void apply (int node, int value) const;
+
+  /**
+   * @brief Recompute maxima of all ancestors of a node.
+   * @param node Index of the node.
+   */
+  void build (int node);
+
+  /**
+   * @brief Propagate pending increments from the root down to a node.
+   * @param node Index of the node.
+   */
+  void push (int node) const;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h" // REQUIRE
+
+inline int RangeMaxTree::operator[] (int position) const
+{
+  return max (position, position);
+}
+
+inline int RangeMaxTree::size (void) const
+{
+  return _size;
+}
+
+inline void RangeMaxTree::apply (int node, int value) const
+{
+  _nodes [node] += value;
+  if (node < _size) { _pending [node] += value; }
+}
+
+#endif // RANGE_MAX_TREE_H
@@ -89,6 +89,15 @@ class RateContainer
    */
   virtual void set_rate (int index, double value) = 0;
 
+  /**
+   * @brief Reorganize internal structure for faster drawing.
+   *
+   * Containers may adapt their structure to the drawings observed so far.
+   * This is never done while drawing or updating cumulates, only when
+   * prompted by user (nothing is done by default).
+   */
+  virtual void reshape (void) {}
+
 
   // ============================
   //  Public Methods - Accessors
@@ -119,6 +119,23 @@ class RateTreeFactory : public RateContainerFactory
     { output << "RateTree"; return output; }
 };
 
+/**
+ * @brief Factory class creating KaryRateTree.
+ */
+class KaryRateTreeFactory : public RateContainerFactory
+{
+ public:
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  RateContainer* create (const SimulationParams& params, int number_rates) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "KaryRateTree"; return output; }
+};
+
 /**
  * @brief Factory class creating HybridRateContainer.
  */
@@ -136,13 +153,50 @@ class HybridRateContainerFactory : public RateContainerFactory
     { output << "HybridRateContainer"; return output; }
 };
 
+/**
+ * @brief Factory class creating AliasTable.
+ */
+class AliasTableFactory : public RateContainerFactory
+{
+ public:
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  RateContainer* create (const SimulationParams& params, int number_rates) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "AliasTable"; return output; }
+};
+
+/**
+ * @brief Factory class creating SortingRateVector.
+ */
+class SortingRateVectorFactory : public RateContainerFactory
+{
+ public:
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  RateContainer* create (const SimulationParams& params, int number_rates) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "SortingRateVector"; return output; }
+};
+
 // ======================
 //  Inline declarations
 // ======================
 //
 #include "ratevector.h"
 #include "ratetree.h"
+#include "karyratetree.h"
 #include "hybridratecontainer.h"
+#include "aliastable.h"
+#include "sortingratevector.h"
 
 inline RateContainer* 
 RateVectorFactory::create (const SimulationParams& params, 
@@ -154,7 +208,14 @@ RateVectorFactory::create (const SimulationParams& params,
 inline RateContainer* 
 RateTreeFactory::create (const SimulationParams& params, int number_rates) const
 {
-  return new RateTree (number_rates);
+  return new RateTree (number_rates, params.tree_rebuild_interval());
+}
+
+inline RateContainer* 
+KaryRateTreeFactory::create (const SimulationParams& params,
+			     int number_rates) const
+{
+  return new KaryRateTree (number_rates);
 }
 
 inline RateContainer* 
@@ -164,5 +225,18 @@ HybridRateContainerFactory::create (const SimulationParams& params,
   return new HybridRateContainer (number_rates, params.hybrid_base_rate());
 }
 
+inline RateContainer* 
+AliasTableFactory::create (const SimulationParams& params, 
+			   int number_rates) const
+{
+  return new AliasTable (number_rates);
+}
+
+inline RateContainer* 
+SortingRateVectorFactory::create (const SimulationParams& params,
+				  int number_rates) const
+{
+  return new SortingRateVector (number_rates);
+}
 
 #endif // RATE_CONTAINER_FACTORY_H
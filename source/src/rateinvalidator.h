@@ -41,8 +41,8 @@
  * @brief Class noticing parent when rate changes.
  *
  * RateInvalidator uses an observer pattern to receive notifications from 
- * other objects used to invalidate a reaction rate stored in a RateValidity
- * object.
+ * other objects used to invalidate reaction rates stored in a RateValidity
+ * object (a row of rates depending on the notifying object).
  */
 class RateInvalidator
 {
@@ -54,7 +54,8 @@ class RateInvalidator
   /**
    * @brief Constructor.
    * @param parent Reference to the parent to warn when a change occurs.
-   * @param rate_index Index of rate to invalidate when a change occurs.
+   * @param rate_index Index of row of rates to invalidate when a change
+   *  occurs.
    */
   RateInvalidator (RateValidity& parent, int rate_index);
 
@@ -123,7 +124,7 @@ RateInvalidator::RateInvalidator (RateValidity& parent, int rate_index)
 
 inline void RateInvalidator::update (void)
 {
-  _parent.invalidate (_index);
+  _parent.invalidate_row (_index);
 }
 
  
@@ -32,6 +32,11 @@
 #include "ratemanager.h"
 #include "simulationparams.h"
 #include "ratecontainerfactory.h"
+#include "reactant.h"
+
+#include <map> // std::map
+#include <queue> // std::queue
+#include <algorithm> // std::reverse std::max
 
 // ==========================
 //  Constructors/Destructors
@@ -41,12 +46,25 @@ RateManager::RateManager (const SimulationParams& params,
 			  const std::vector <Reaction*>& reactions)
   : _reactions (reactions)
 {
+  if (params.reorder_reactions()) { _reorder_reactions(); }
   _rates = params.rate_container_factory().create (params, reactions.size());
 
   compute_all_rates();
   cumulate_rates();
 }
 
+RateManager::RateManager (const SimulationParams& params,
+			  const std::vector <Reaction*>& reactions,
+			  const RateContainerFactory& factory)
+  : _reactions (reactions)
+{
+  if (params.reorder_reactions()) { _reorder_reactions(); }
+  _rates = factory.create (params, reactions.size());
+
+  compute_all_rates();
+  cumulate_rates();
+}
+
 // Forbidden
 // RateManager::RateManager (const RateManager& other_rate_manager);
 // RateManager& RateManager::operator= (const RateManager& other_rate_manager);
@@ -71,3 +89,80 @@ RateManager::~RateManager (void)
 //  Private Methods
 // =================
 //
+void RateManager::_reorder_reactions (void)
+{
+  // list reactions depending on every reactant (in order of appearance)
+  std::map <Reactant*, int> reactant_indices;
+  std::vector < std::vector <int> > reactant_reactions;
+  std::vector < std::vector <int> > reaction_reactants (_reactions.size());
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    {
+      const std::vector <Reactant*>& reactants = _reactions [i]->reactants();
+      for (std::size_t r = 0; r < reactants.size(); ++r)
+	{
+	  std::map <Reactant*, int>::iterator it
+	    = reactant_indices.find (reactants [r]);
+	  if (it == reactant_indices.end())
+	    {
+	      it = reactant_indices.insert
+		(std::make_pair (reactants [r], reactant_reactions.size())).first;
+	      reactant_reactions.push_back (std::vector <int>());
+	    }
+	  reactant_reactions [it->second].push_back (i);
+	  reaction_reactants [i].push_back (it->second);
+	}
+    }
+
+  // Cuthill-McKee ordering on the reaction-reactant graph: breadth-first
+  // traversal where all unvisited reactions sharing a reactant are numbered
+  // together, every connected component starting from the reaction with
+  // fewest reactants
+  std::size_t max_degree = 0;
+  for (std::size_t i = 0; i < _reactions.size(); ++i)
+    { max_degree = std::max (max_degree, reaction_reactants [i].size()); }
+  std::vector <int> starts;
+  starts.reserve (_reactions.size());
+  for (std::size_t degree = 0; degree <= max_degree; ++degree)
+    {
+      for (std::size_t i = 0; i < _reactions.size(); ++i)
+	{ if (reaction_reactants [i].size() == degree) { starts.push_back (i); } }
+    }
+  std::vector <int> order;
+  order.reserve (_reactions.size());
+  std::vector <bool> reaction_visited (_reactions.size(), false);
+  std::vector <bool> reactant_visited (reactant_reactions.size(), false);
+  for (std::size_t s = 0; s < starts.size(); ++s)
+    {
+      int start = starts [s];
+      if (reaction_visited [start]) { continue; }
+      std::queue <int> to_visit;
+      to_visit.push (start);
+      reaction_visited [start] = true;
+      while (!to_visit.empty())
+	{
+	  int reaction = to_visit.front(); to_visit.pop();
+	  order.push_back (reaction);
+	  const std::vector <int>& reactants = reaction_reactants [reaction];
+	  for (std::size_t r = 0; r < reactants.size(); ++r)
+	    {
+	      if (reactant_visited [reactants [r]]) { continue; }
+	      reactant_visited [reactants [r]] = true;
+	      const std::vector <int>& neighbours
+		= reactant_reactions [reactants [r]];
+	      for (std::size_t n = 0; n < neighbours.size(); ++n)
+		{
+		  if (reaction_visited [neighbours [n]]) { continue; }
+		  reaction_visited [neighbours [n]] = true;
+		  to_visit.push (neighbours [n]);
+		}
+	    }
+	}
+    }
+
+  // reverse ordering (usually yields a smaller profile) and apply it
+  std::reverse (order.begin(), order.end());
+  std::vector <Reaction*> reactions (_reactions.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+    { reactions [i] = _reactions [order [i]]; }
+  _reactions.swap (reactions);
+}
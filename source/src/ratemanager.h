@@ -45,6 +45,11 @@
  * by inheriting classes. Objects are built from vectors of reactions
  * and are responsible for updating rates when prompted by user. Rates
  * are made available in a vector that of same size as reaction vector.
+ * If requested by simulation parameters, the manager reorders its own copy
+ * of the reaction vector so that reactions sharing reactants (and therefore
+ * invalidated together) are stored next to each other in the rate
+ * container. Reactions are only exposed through references, so this order
+ * is invisible outside of the manager.
  */
 class RateManager
 {
@@ -63,6 +68,18 @@ class RateManager
   RateManager (const SimulationParams& params,
 	       const std::vector <Reaction*>& reactions);
 
+  /**
+   * @brief Constructor with specific rate container.
+   * @param params Simulation parameters.
+   * @param reactions Vector of reactions whose rates need to be stored and
+   *  updated.
+   * @param factory Factory used to create the rate container (instead of the
+   *  one specified in the simulation parameters).
+   */
+  RateManager (const SimulationParams& params,
+	       const std::vector <Reaction*>& reactions,
+	       const RateContainerFactory& factory);
+
  private:
   // Forbidden
   /** @brief Copy constructor. */
@@ -96,6 +113,11 @@ class RateManager
    */
   Reaction& random_reaction (void);
 
+  /**
+   * @brief Let rate container reorganize itself for faster drawing.
+   */
+  void reshape_rates (void);
+
   // ============================
   //  Public Methods - Accessors
   // ============================
@@ -136,6 +158,12 @@ class RateManager
    * @brief Accessor to reaction vector.
    */
   const std::vector <Reaction*>& reactions (void) const;
+
+  /**
+   * @brief Accessor to rate container.
+   * @return Container storing reaction rates.
+   */
+  RateContainer& rate_container (void);
   
 
  private:
@@ -155,6 +183,11 @@ class RateManager
   //  Private Methods
   // =================
   //
+  /**
+   * @brief Reorder reactions by reverse Cuthill-McKee ordering on the graph
+   *  linking reactions to their reactants.
+   */
+  void _reorder_reactions (void);
 };
 
 // ======================
@@ -175,6 +208,11 @@ inline void RateManager::compute_all_rates (void)
   for (std::size_t i = 0; i < _reactions.size(); ++i) { update_reaction (i); }
 }
 
+inline void RateManager::reshape_rates (void)
+{
+  _rates->reshape();
+}
+
 inline void RateManager::cumulate_rates (void)
 {
   _rates->update_cumulates();
@@ -197,6 +235,11 @@ inline const std::vector<Reaction*>& RateManager::reactions (void) const
   return _reactions;
 }
 
+inline RateContainer& RateManager::rate_container (void)
+{
+  return *_rates;
+}
+
 inline std::ostream& operator<< (std::ostream& output,
 				 const RateManager& manager)
 {
@@ -101,6 +101,9 @@ class DependencyRateManagerFactory : public RateManagerFactory
 //
 #include "naiveratemanager.h"
 #include "dependencyratemanager.h"
+#include "specializeddependencyratemanager.h"
+#include "simulationparams.h"
+#include "ratecontainerfactory.h"
 
 inline RateManager* 
 NaiveRateManagerFactory::create (const SimulationParams& params,
@@ -113,6 +116,25 @@ inline RateManager*
 DependencyRateManagerFactory::create (const SimulationParams& params,
 				      const std::vector <Reaction*>& reactions) const
 {
+  // the container type is resolved once here, so that the manager can update
+  // rates without virtual calls to the container (alias tables are only
+  // used by constant rate groups, which do not use this factory)
+  const RateContainerFactory& factory = params.rate_container_factory();
+  if (dynamic_cast <const RateTreeFactory*> (&factory) != 0)
+    { return new SpecializedDependencyRateManager <RateTree>
+	(params, reactions); }
+  if (dynamic_cast <const RateVectorFactory*> (&factory) != 0)
+    { return new SpecializedDependencyRateManager <RateVector>
+	(params, reactions); }
+  if (dynamic_cast <const KaryRateTreeFactory*> (&factory) != 0)
+    { return new SpecializedDependencyRateManager <KaryRateTree>
+	(params, reactions); }
+  if (dynamic_cast <const HybridRateContainerFactory*> (&factory) != 0)
+    { return new SpecializedDependencyRateManager <HybridRateContainer>
+	(params, reactions); }
+  if (dynamic_cast <const SortingRateVectorFactory*> (&factory) != 0)
+    { return new SpecializedDependencyRateManager <SortingRateVector>
+	(params, reactions); }
   return new DependencyRateManager (params, reactions);
 }
 
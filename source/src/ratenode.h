@@ -25,6 +25,7 @@
 //  General Includes
 // ==================
 //
+#include <algorithm> // std::max
 
 // ======================
 //  Forward declarations
@@ -53,7 +54,8 @@ class RateNode
   /**
    * @brief Default constructor.
    */
-  RateNode (void) : _parent (0),  _rate (0), _invalidated (false)  {}
+  RateNode (void) 
+    : _parent (0),  _rate (0), _invalidated (false), _height (0)  {}
 
   // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
@@ -124,6 +126,13 @@ class RateNode
    */
   bool is_invalidated (void) { return _invalidated; }
 
+  /**
+   * @brief Accessor to height of the node.
+   * @return Length of the longest path from the node down to a leaf (leaves
+   *  have height 0, parents are always higher than their children).
+   */
+  int height (void) { return _height; }
+
 protected:
   // ===================
   //  Protected Methods
@@ -135,6 +144,12 @@ protected:
    */
   void _set_rate (double value) { _rate = value; }
 
+  /**
+   * @brief Setter for height.
+   * @param value Height of the node above leaves.
+   */
+  void _set_height (int value) { _height = value; }
+
   /**
    * @brief Invalidate parent if needed.
    * @return Pointer to parent if it has not already been invalidate, 0 if it
@@ -160,6 +175,9 @@ private:
   /** @brief Flag indicating if the node needs to be updated. */
   bool _invalidated;
 
+  /** @brief Height of the node above leaves. */
+  int _height;
+
   // =================
   //  Private Methods
   // =================
@@ -191,7 +209,12 @@ class DummyNode : public RateNode
   /**
    * @brief Default constructor.
    */
-  DummyNode (RateNode& child) : _child (child) { update(); }
+  DummyNode (RateNode& child) 
+    : _child (child) 
+  { 
+    _set_height (child.height() + 1);
+    update(); 
+  }
 
     // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
@@ -325,6 +348,7 @@ class SumNode : public RateNode
     : _left (left_child)
     , _right (right_child)
   {
+    _set_height (std::max (left_child.height(), right_child.height()) + 1);
     update();
   }
 
@@ -24,7 +24,9 @@
 // ==================
 //
 #include <iostream> // std::cout
-#include <queue> // std::queue
+#include <queue> // std::queue std::priority_queue
+#include <functional> // std::greater
+#include <iterator> // std::advance
 #include <cmath> // fabs
 
 // ==================
@@ -38,23 +40,90 @@
 //  Constructors/Destructors
 // ==========================
 //
-RateTree::RateTree (int number_rates)
-  // care: number of nodes can be larger than number of rates because of dummy
-  // nodes !!! Twice the number of rates is a very generous overestimate.
-  : _update_queue (2*number_rates) 
+RateTree::RateTree (int number_rates, int rebuild_interval)
+  : _rebuild_interval (rebuild_interval)
+  , _number_draws (0)
+  , _draw_counts (number_rates, 0)
 {
+  /** @pre rebuild_interval must be positive. */
+  REQUIRE (rebuild_interval >= 0);
+
   // first create leaves
   _leaves.reserve (number_rates);
-  std::queue <RateNode*>* current_layer = new std::queue <RateNode*>;
   for (int i = 0; i < number_rates; ++i)
     {
       ReactionNode* node = new ReactionNode (i);
       _nodes.push_back (node);
       _leaves.push_back (node);
-      current_layer->push (node);
     }
+  _build_balanced();
+  _reset_update_levels();
+}
+
+// Forbidden
+// RateTree::RateTree (const RateTree& other_tree);
+// RateTree& RateTree::operator= (const RateTree& other_tree);
+
+RateTree::~RateTree (void)
+{
+  for (std::list<RateNode*>::iterator node_it = _nodes.begin();
+       node_it != _nodes.end(); ++node_it)
+    { delete *node_it; }
+}
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void RateTree::update_cumulates (void)
+{
+  // parents are higher than their children: processing levels by increasing
+  // height ensures that a node is updated after all its invalidated children
+  for (std::size_t height = 1; height < _update_levels.size(); ++height)
+    {
+      std::vector <RateNode*>& level = _update_levels [height];
+      for (std::size_t i = 0; i < level.size(); ++i)
+	{
+	  RateNode* next = level [i]->update();
+	  if (next != 0) { _update_levels [next->height()].push_back (next); }
+	}
+      level.clear();
+    }
+
+  // total must be approximately equal to sum of leaf nodes 
+  ENSURE (fabs (_root->rate() - _sum_of_leaf_rates()) <= 1e-13*_root->rate());
+}
+
+void RateTree::reshape (void)
+{
+  if ((_rebuild_interval == 0) || (_number_draws < _rebuild_interval)) 
+    { return; }
+
+  // new sum nodes are computed from current leaf rates, pending updates can
+  // be dropped
+  _delete_sum_nodes();
+  _build_from_counts();
+  _reset_update_levels();
+  for (std::size_t i = 0; i < _draw_counts.size(); ++i)
+    { _draw_counts [i] /= 2; }
+  _number_draws = 0;
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
 
+// =================
+//  Private Methods
+// =================
+//
+void RateTree::_build_balanced (void)
+{
   // create parents from leaves
+  std::queue <RateNode*>* current_layer = new std::queue <RateNode*>;
+  for (std::size_t i = 0; i < _leaves.size(); ++i)
+    { current_layer->push (_leaves [i]); }
   std::queue <RateNode*>* next_layer = new std::queue <RateNode*>;
   std::queue <RateNode*>* tmp = 0;
   RateNode* left, *right;
@@ -88,41 +157,47 @@ RateTree::RateTree (int number_rates)
   _root = _nodes.back();
 }
 
-// Forbidden
-// RateTree::RateTree (const RateTree& other_tree);
-// RateTree& RateTree::operator= (const RateTree& other_tree);
-
-RateTree::~RateTree (void)
-{
-  for (std::list<RateNode*>::iterator node_it = _nodes.begin();
-       node_it != _nodes.end(); ++node_it)
-    { delete *node_it; }
-}
-
-// ===========================
-//  Public Methods - Commands
-// ===========================
-//
-void RateTree::update_cumulates (void)
+void RateTree::_build_from_counts (void)
 {
-  while (_update_queue.end() == false)
+  // merge two lightest nodes until one is left, ties are broken by creation
+  // order so that the shape does not depend on memory layout
+  typedef std::pair <double, int> WeightedNode;
+  std::priority_queue <WeightedNode, std::vector <WeightedNode>,
+		       std::greater <WeightedNode> > queue;
+  std::vector <RateNode*> nodes (_leaves.begin(), _leaves.end());
+  for (std::size_t i = 0; i < _leaves.size(); ++i)
     {
-      RateNode* next = _update_queue.item()->update();
-      if (next != 0) { _update_queue.push (next); }
-      _update_queue.next();
+      // never drawn rates get a unit weight so they are still ordered
+      queue.push (WeightedNode (_draw_counts [i] + 1, i));
     }
-  _update_queue.clear();
-
-  // total must be approximately equal to sum of leaf nodes 
-  ENSURE (fabs (_root->rate() - _sum_of_leaf_rates()) <= 1e-13*_root->rate());
+  while (queue.size() > 1)
+    {
+      WeightedNode left = queue.top(); queue.pop();
+      WeightedNode right = queue.top(); queue.pop();
+      SumNode* parent = new SumNode (*nodes [left.second],
+				     *nodes [right.second]);
+      nodes [left.second]->set_parent (parent);
+      nodes [right.second]->set_parent (parent);
+      _nodes.push_back (parent);
+      nodes.push_back (parent);
+      queue.push (WeightedNode (left.first + right.first, nodes.size()-1));
+    }
+  _root = _nodes.back();
 }
 
-// ============================
-//  Public Methods - Accessors
-// ============================
-//
+void RateTree::_reset_update_levels (void)
+{
+  for (std::size_t i = 0; i < _update_levels.size(); ++i)
+    { _update_levels [i].clear(); }
+  _update_levels.resize (_root->height() + 1);
+}
 
-// =================
-//  Private Methods
-// =================
-//
+void RateTree::_delete_sum_nodes (void)
+{
+  std::list <RateNode*>::iterator first_sum_node = _nodes.begin();
+  std::advance (first_sum_node, _leaves.size());
+  for (std::list <RateNode*>::iterator node_it = first_sum_node;
+       node_it != _nodes.end(); ++node_it)
+    { delete *node_it; }
+  _nodes.erase (first_sum_node, _nodes.end());
+}
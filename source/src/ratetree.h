@@ -37,7 +37,6 @@
 //
 #include "forwarddeclarations.h"
 #include "ratecontainer.h"
-#include "vectorqueue.h"
 
 /**
  * @brief Class storing rates using a binary tree to cumulate rates.
@@ -47,7 +46,17 @@
  * only the parents of the leaves need to be updated. Drawing of random reaction
  * is efficient as searching for a cumulated value is done by going down from
  * the root, as in binary search. Both operations are O(logN) where N is the 
- * number of stored rates.
+ * number of stored rates. Updates are propagated by increasing node height,
+ * so that every node is updated once even when leaves lie at different
+ * depths.
+ *
+ * Optionally, the tree counts how many times every rate is drawn and
+ * periodically rebuilds its shape as a Huffman tree weighted by these counts.
+ * Frequently drawn rates then sit close to the root, which lowers the
+ * expected depth of a search. The rebuild is never performed while drawing or
+ * updating cumulates: it happens when the owner calls reshape() (e.g.
+ * between two output steps) after a given number of drawings, counts being
+ * halved afterwards so that the shape follows recent firing frequencies.
  * @sa RateVector.
  * @sa RateNode, SumNode, ReactionNode, DummyNode.
  */
@@ -60,8 +69,11 @@ class RateTree : public RateContainer
   //
   /**
    * @brief Constructor.
+   * @param number_rates Number of rates to store.
+   * @param rebuild_interval Number of drawings between two rebuilds of the
+   *  tree shape from drawing frequencies (0 to keep a balanced tree).
    */
-  RateTree (int number_rates);
+  RateTree (int number_rates, int rebuild_interval = 0);
 
  private:
   // Forbidden
@@ -85,13 +97,21 @@ class RateTree : public RateContainer
   void update_cumulates (void);
   void set_rate (int index, double value);
 
+  /**
+   * @brief Rebuild tree shape from drawing frequencies if enough drawings
+   *  were recorded since last rebuild.
+   */
+  void reshape (void);
+
   /**
    * @brief Find reaction index corresponding to cumulated rate value.
    * @param value Cumulated rate value.
    * @return Reaction index such that the cumulated rate < index
    *  is smaller than cumulated_value while the cumulated rate <= index
    *  is greater or equal to cumulated_value. This index is computed from
-   *  the cumulated rates as of last update, not current rates.
+   *  the cumulated rates as of last update, not current rates. Rates are
+   *  cumulated in leaf order, which differs from index order once the tree
+   *  has been rebuilt from drawing frequencies.
    */
   int find (double value) const;
 
@@ -102,6 +122,13 @@ class RateTree : public RateContainer
   // Redefined from RateContainer
   double total_rate (void) const;
 
+  /**
+   * @brief Accessor to depth of a rate in the tree.
+   * @param index Index of the rate.
+   * @return Number of nodes between the leaf holding the rate and the root.
+   */
+  int depth (int index) const;
+
 private:
   // ============
   //  Attributes
@@ -113,12 +140,24 @@ private:
   /** @brief Leaves of tree (holding reaction rates). */
   std::vector <ReactionNode*> _leaves;
 
-  /** @brief Queue of nodes to update. */
-  VectorQueue <RateNode*> _update_queue;
+  /** @brief Nodes to update, indexed by their height. */
+  std::vector <std::vector <RateNode*> > _update_levels;
 
-  /** @brief Nodes of tree. */
+  /** @brief Nodes of tree (leaves first). */
   std::list <RateNode*> _nodes;
 
+  /** @brief Number of drawings between two rebuilds (0 for none). */
+  int _rebuild_interval;
+
+  /**
+   * @brief Number of drawings since last rebuild (saturates at rebuild
+   *  interval).
+   */
+  mutable int _number_draws;
+
+  /** @brief Number of times every rate was drawn (decayed at rebuilds). */
+  mutable std::vector <double> _draw_counts;
+
   // =================
   //  Private Methods
   // =================
@@ -133,6 +172,26 @@ private:
    * This function is for verification purposes.
    */
   double _sum_of_leaf_rates (void) const;  
+
+  /**
+   * @brief Build balanced tree above leaves.
+   */
+  void _build_balanced (void);
+
+  /**
+   * @brief Build Huffman tree above leaves, weighted by drawing counts.
+   */
+  void _build_from_counts (void);
+
+  /**
+   * @brief Resize update levels to the height of the current tree.
+   */
+  void _reset_update_levels (void);
+
+  /**
+   * @brief Delete all nodes except leaves.
+   */
+  void _delete_sum_nodes (void);
 };
 
 // ======================
@@ -173,15 +232,32 @@ inline void RateTree::set_rate (int index, double value)
   REQUIRE (value >= 0);
 
   RateNode* next = _leaves [index]->set_rate (value);
-  if (next != 0) _update_queue.push (next);
+  if (next != 0) _update_levels [next->height()].push_back (next);
 }
 
 inline int RateTree::random_index (void) const
 {
   /** Total rate must be strictly positive. */
   ENSURE (total_rate() > 0);
-  return find (RandomHandler::instance().draw_uniform
-	       (1e-16*total_rate(), total_rate()));
+  int index = find (RandomHandler::instance().draw_uniform
+		    (1e-16*total_rate(), total_rate()));
+  if (_rebuild_interval > 0)
+    {
+      ++_draw_counts [index];
+      if (_number_draws < _rebuild_interval) { ++_number_draws; }
+    }
+  return index;
+}
+
+inline int RateTree::depth (int index) const
+{
+  /** @pre index must be consistent with number of rates. */
+  REQUIRE ((index >= 0) && (index < _leaves.size()));
+  int result = 0;
+  for (RateNode* node = _leaves [index]; node != _root;
+       node = node->parent())
+    { ++result; }
+  return result;
 }
 
 inline double RateTree::_sum_of_leaf_rates (void) const
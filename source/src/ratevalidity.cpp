@@ -20,6 +20,7 @@
 //  General Includes
 // ==================
 //
+#include <map> // std::map
 
 // ==================
 //  Project Includes
@@ -27,6 +28,8 @@
 //
 #include "ratevalidity.h"
 #include "rateinvalidator.h"
+#include "reaction.h"
+#include "reactant.h"
 
 // ==========================
 //  Constructors/Destructors
@@ -34,12 +37,15 @@
 //
 RateValidity::RateValidity (int number_rates)
   : _invalidated (number_rates, false)
-  , _invalidators (number_rates)
+  , _row_starts (1, 0)
 {
   /** @pre number_rates must be positive. */
   REQUIRE (number_rates > 0);
-  for (std::size_t i = 0; i < _invalidators.size(); ++i)
-    { _invalidators[i] = new RateInvalidator (*this, i); }
+  _row_starts.reserve (number_rates+1);
+  _row_rates.reserve (number_rates);
+  _invalidators.reserve (number_rates);
+  for (int i = 0; i < number_rates; ++i)
+    { add_row (std::vector <int> (1, i)); }
 }
 
 // RateValidity::RateValidity (const RateValidity& other);
@@ -47,6 +53,8 @@ RateValidity::RateValidity (int number_rates)
 
 RateValidity::~RateValidity (void)
 {
+  for (std::size_t i = 0; i < _watched.size(); ++i)
+    { _watched [i].first->detach (*_watched [i].second); }
   for (std::vector <RateInvalidator*>::iterator it = _invalidators.begin();
        it != _invalidators.end(); ++it)
     { delete *it; }
@@ -60,12 +68,52 @@ void RateValidity::extend (int extension_size)
 {
   /** @pre extension_size must be positive. */
   REQUIRE (extension_size > 0);
+  /** @pre Rows must not have been compiled from reactants. */
+  REQUIRE (_watched.empty());
   int old_size = _invalidated.size();
   int new_size = old_size + extension_size;
   _invalidated.resize (new_size, false);
-  _invalidators.resize (new_size);
   for (int i = old_size; i < new_size; ++i)
-    { _invalidators[i] = new RateInvalidator (*this, i); }
+    { add_row (std::vector <int> (1, i)); }
+}
+
+void RateValidity::watch (const std::vector <Reaction*>& reactions)
+{
+  /** @pre Reactions must be consistent with number of rates. */
+  REQUIRE (reactions.size() <= _invalidated.size());
+
+  // list reactions depending on every reactant (in order of appearance so
+  // that rows do not depend on memory layout)
+  std::map <Reactant*, int> reactant_rows;
+  std::vector <Reactant*> reactants;
+  std::vector < std::vector <int> > rows;
+  for (std::size_t i = 0; i < reactions.size(); ++i)
+    {
+      const std::vector <Reactant*>& reaction_reactants
+	= reactions [i]->reactants();
+      for (std::size_t r = 0; r < reaction_reactants.size(); ++r)
+	{
+	  std::map <Reactant*, int>::iterator row_it
+	    = reactant_rows.find (reaction_reactants [r]);
+	  if (row_it == reactant_rows.end())
+	    {
+	      row_it = reactant_rows.insert
+		(std::make_pair (reaction_reactants [r], rows.size())).first;
+	      reactants.push_back (reaction_reactants [r]);
+	      rows.push_back (std::vector <int>());
+	    }
+	  std::vector <int>& row = rows [row_it->second];
+	  if (row.empty() || (row.back() != int (i))) { row.push_back (i); }
+	}
+    }
+
+  // compile rows and attach one observer per reactant
+  for (std::size_t r = 0; r < rows.size(); ++r)
+    {
+      RateInvalidator& invalidator = add_row (rows [r]);
+      reactants [r]->attach (invalidator);
+      _watched.push_back (std::make_pair (reactants [r], &invalidator));
+    }
 }
 
 // ============================
@@ -77,3 +125,10 @@ void RateValidity::extend (int extension_size)
 //  Private Methods
 // =================
 //
+RateInvalidator& RateValidity::add_row (const std::vector <int>& rates)
+{
+  _row_rates.insert (_row_rates.end(), rates.begin(), rates.end());
+  _row_starts.push_back (_row_rates.size());
+  _invalidators.push_back (new RateInvalidator (*this, _row_starts.size()-2));
+  return *(_invalidators.back());
+}
@@ -26,7 +26,6 @@
 // ==================
 //
 #include <vector> // std::vector
-#include <stack> // std::stack
 
 // ======================
 //  Forward declarations
@@ -38,11 +37,18 @@
 /**
  * @brief Class monitoring validity of reaction rates.
  *
- * RateValidity is a stack storing indices of rates to update.
+ * RateValidity stores indices of rates to update. Outdated rates are flagged
+ * in a bitset and listed in a dense vector used as a stack. Invalidations
+ * are received through RateInvalidator observers, each of which invalidates
+ * a row of rates stored in compressed sparse row format: row i initially
+ * contains rate i only, and rows grouping all rates that depend on a given
+ * reactant can be compiled with watch(), so that a reactant change triggers
+ * a single notification followed by a contiguous scan of dependent rates.
  */
 class RateValidity
 {
  public:
+
   // ==========================
   //  Constructors/Destructors
   // ==========================
@@ -59,9 +65,9 @@ class RateValidity
   RateValidity (const RateValidity& other);
   /** @brief Assignment operator. */
   RateValidity& operator= (const RateValidity& other);
- public:
 
-  /** @brief Destructor. */
+ public:
+  /** @brief Destructor (detaches observers from watched reactants). */
   ~RateValidity (void);
 
   // ===========================
@@ -74,17 +80,39 @@ class RateValidity
    */
   void invalidate (int identifier);
 
+  /**
+   * @brief Mark all rates of a row as outdated.
+   * @param row Index of row whose rates should be updated.
+   */
+  void invalidate_row (int row);
+
   /**
    * @brief Remove next element from update stack.
    */
   void pop (void);
 
+  /**
+   * @brief Remove all elements from update stack.
+   */
+  void clear (void);
+
   /**
    * @brief Extend size of object.
    * @param extension_size Number of elements to add.
    */
   void extend (int extension_size);
 
+  /**
+   * @brief Invalidate rates of reactions whenever one of their reactants
+   *  changes.
+   * @param reactions Reactions whose index in the vector is the identifier
+   *  of their rate.
+   *
+   * One row is created for every distinct reactant and a single observer per
+   * reactant is attached. Observers are detached upon destruction.
+   */
+  void watch (const std::vector <Reaction*>& reactions);
+
   // ============================
   //  Public Methods - Accessors
   // ============================
@@ -101,6 +129,12 @@ class RateValidity
    */
   bool empty (void) const;
 
+  /**
+   * @brief Accessor to outdated rates.
+   * @return Vector of identifiers of rates to update (without duplicates).
+   */
+  const std::vector <int>& invalid_rates (void) const;
+
   /**
    * @brief Accessor to observer used to invalidate specific rate.
    * @param identifier Identifier of rate to invalidate.
@@ -113,19 +147,34 @@ private:
   //  Private Methods
   // =================
   //
+  /**
+   * @brief Append a row of rates invalidated together.
+   * @param rates Identifiers of rates in the row.
+   * @return Observer invalidating the new row.
+   */
+  RateInvalidator& add_row (const std::vector <int>& rates);
 
   // ============
   //  Attributes
   // ============
   //
   /** @brief Flag telling if elements have already been stacked for update. */
-  std::vector <int> _invalidated;
+  std::vector <bool> _invalidated;
+
+  /** @brief Position of first rate of every row (plus end of last row). */
+  std::vector <int> _row_starts;
+
+  /** @brief Rates of all rows, stored contiguously. */
+  std::vector <int> _row_rates;
 
-  /** @brief Invalidators used as observers to invalidate a specific rate. */
+  /** @brief Invalidators used as observers to invalidate a specific row. */
   std::vector <RateInvalidator*> _invalidators;
 
+  /** @brief Reactants watched and the invalidator attached to them. */
+  std::vector <std::pair <Reactant*, RateInvalidator*> > _watched;
+
   /** @brief Stack holding indices of elements to update. */
-  std::stack <int, std::vector <int> > _update_stack;
+  std::vector <int> _update_stack;
 };
 
 // ======================
@@ -137,23 +186,38 @@ inline void RateValidity::invalidate (int identifier)
   /** @pre identifier must be consistent with number of rates to watch. */
   REQUIRE ((identifier >= 0) && (identifier < _invalidated.size()));
   if (_invalidated [identifier]) return;
-  _update_stack.push (identifier);
+  _update_stack.push_back (identifier);
   _invalidated [identifier] = true;
 }
 
+inline void RateValidity::invalidate_row (int row)
+{
+  /** @pre row must be consistent with number of rows. */
+  REQUIRE ((row >= 0) && (row+1 < _row_starts.size()));
+  for (int i = _row_starts [row]; i < _row_starts [row+1]; ++i)
+    { invalidate (_row_rates [i]); }
+}
+
 inline void RateValidity::pop (void)
 { 
   /** @pre Update stack must not be empty. */
   REQUIRE (!empty());
-  _invalidated [_update_stack.top()] = false;
-  _update_stack.pop(); 
+  _invalidated [_update_stack.back()] = false;
+  _update_stack.pop_back(); 
+}
+
+inline void RateValidity::clear (void)
+{ 
+  for (std::size_t i = 0; i < _update_stack.size(); ++i)
+    { _invalidated [_update_stack [i]] = false; }
+  _update_stack.clear();
 }
 
 inline int RateValidity::front (void) const
 { 
   /** @pre Update stack must not be empty. */
   REQUIRE (!empty());
-  return _update_stack.top();
+  return _update_stack.back();
 }
 
 inline bool RateValidity::empty (void) const
@@ -161,10 +225,15 @@ inline bool RateValidity::empty (void) const
   return _update_stack.empty(); 
 }
 
+inline const std::vector <int>& RateValidity::invalid_rates (void) const
+{
+  return _update_stack;
+}
+
 inline RateInvalidator& RateValidity::invalidator (int identifier) const
 {
   /** @pre identifier must be consistent with number of rates to watch. */
-  REQUIRE ((identifier >= 0) && (identifier < _invalidators.size()));
+  REQUIRE ((identifier >= 0) && (identifier < _invalidated.size()));
   return *(_invalidators [identifier]);
 }
 
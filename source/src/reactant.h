@@ -25,7 +25,8 @@
 //  General Includes
 // ==================
 //
-#include <list> // std::list
+#include <vector> // std::vector
+#include <algorithm> // std::remove
 
 // ==================
 //  Project Includes
@@ -94,8 +95,8 @@ class Reactant
   //  Attributes
   // ============
   //  
-  /** @brief Set of observers to notify. */
-  std::list <RateInvalidator*> _observers;
+  /** @brief Observers to notify (stored contiguously). */
+  std::vector <RateInvalidator*> _observers;
 };
 
 // ======================
@@ -113,14 +114,14 @@ inline void Reactant::attach (RateInvalidator& observer)
 
 inline void Reactant::detach (RateInvalidator& observer) 
 {
-  _observers.remove (&observer);
+  _observers.erase (std::remove (_observers.begin(), _observers.end(),
+				 &observer), _observers.end());
 }
 
 inline void Reactant::notify_change (void)
 {
-  for (std::list <RateInvalidator*>::iterator obs_it = _observers.begin();
-       obs_it != _observers.end(); ++obs_it)
-    { (*obs_it)->update(); }
+  for (std::size_t i = 0; i < _observers.size(); ++i)
+    { _observers [i]->update(); }
 }
 
 #endif // REACTANT_H
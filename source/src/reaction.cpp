@@ -0,0 +1,159 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+/**
+ * @file reaction.cpp
+ * @brief Implementation of the Reaction class.
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+// ==================
+//  General Includes
+// ==================
+//
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "macros.h" // ENSURE()
+#include "reaction.h"
+#include "forwardreaction.h"
+#include "backwardreaction.h"
+#include "chemicalreaction.h"
+#include "sequencebinding.h"
+#include "translocation.h"
+#include "loading.h"
+#include "release.h"
+#include "doublestrandrecruitment.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void Reaction::perform (void)
+{
+  ++_number_performed;
+  // qualified calls below are resolved at compile time
+  switch (_type)
+    {
+    case FORWARD_CHEMICAL:
+      static_cast <ChemicalReaction&>
+	(static_cast <ForwardReaction*> (this)->_reaction)
+	.ChemicalReaction::perform_forward();
+      break;
+    case BACKWARD_CHEMICAL:
+      static_cast <ChemicalReaction&>
+	(static_cast <BackwardReaction*> (this)->_reaction)
+	.ChemicalReaction::perform_backward();
+      break;
+    case FORWARD_BINDING:
+      static_cast <SequenceBinding&>
+	(static_cast <ForwardReaction*> (this)->_reaction)
+	.SequenceBinding::perform_forward();
+      break;
+    case BACKWARD_BINDING:
+      static_cast <SequenceBinding&>
+	(static_cast <BackwardReaction*> (this)->_reaction)
+	.SequenceBinding::perform_backward();
+      break;
+    case TRANSLOCATION:
+      static_cast <Translocation*> (this)->Translocation::do_reaction();
+      break;
+    case PRODUCT_LOADING:
+      static_cast <Loading*> (this)->Loading::do_reaction();
+      break;
+    case DOUBLE_STRAND_LOADING:
+      static_cast <DoubleStrandLoading*> (this)
+	->DoubleStrandLoading::do_reaction();
+      break;
+    case RELEASE:
+      static_cast <Release*> (this)->Release::do_reaction();
+      break;
+    case DOUBLE_STRAND_RECRUITMENT:
+      static_cast <DoubleStrandRecruitment*> (this)
+	->DoubleStrandRecruitment::do_reaction();
+      break;
+    default:
+      do_reaction();
+    }
+}
+
+void Reaction::update_rate (void)
+{
+  switch (_type)
+    {
+    case FORWARD_CHEMICAL:
+      _rate = static_cast <const ChemicalReaction&>
+	(static_cast <ForwardReaction*> (this)->_reaction)
+	.ChemicalReaction::compute_forward_rate();
+      break;
+    case BACKWARD_CHEMICAL:
+      _rate = static_cast <const ChemicalReaction&>
+	(static_cast <BackwardReaction*> (this)->_reaction)
+	.ChemicalReaction::compute_backward_rate();
+      break;
+    case FORWARD_BINDING:
+      _rate = static_cast <const SequenceBinding&>
+	(static_cast <ForwardReaction*> (this)->_reaction)
+	.SequenceBinding::compute_forward_rate();
+      break;
+    case BACKWARD_BINDING:
+      _rate = static_cast <const SequenceBinding&>
+	(static_cast <BackwardReaction*> (this)->_reaction)
+	.SequenceBinding::compute_backward_rate();
+      break;
+    case TRANSLOCATION:
+      _rate = static_cast <Translocation*> (this)
+	->Translocation::compute_rate();
+      break;
+    case PRODUCT_LOADING:
+    case DOUBLE_STRAND_LOADING:
+      _rate = static_cast <Loading*> (this)->Loading::compute_rate();
+      break;
+    case RELEASE:
+      _rate = static_cast <Release*> (this)->Release::compute_rate();
+      break;
+    case DOUBLE_STRAND_RECRUITMENT:
+      _rate = static_cast <DoubleStrandRecruitment*> (this)
+	->DoubleStrandRecruitment::compute_rate();
+      break;
+    default:
+      _rate = compute_rate();
+    }
+  /** @post Rate must be positive. */
+  ENSURE (_rate >= 0);
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+
+// ===================
+//  Protected Methods
+// ===================
+//
+Reaction::Type Reaction::adapter_type (const BidirectionalReaction& reaction,
+				       bool forward)
+{
+  if (dynamic_cast <const ChemicalReaction*> (&reaction) != 0)
+    { return forward ? FORWARD_CHEMICAL : BACKWARD_CHEMICAL; }
+  if (dynamic_cast <const SequenceBinding*> (&reaction) != 0)
+    { return forward ? FORWARD_BINDING : BACKWARD_BINDING; }
+  return GENERIC;
+}
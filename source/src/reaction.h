@@ -49,6 +49,18 @@
 class Reaction : public SimulatorInput
 {
 public:
+  /**
+   * @brief Concrete type of a reaction.
+   *
+   * The tag lets perform() and update_rate() call the implementation of the
+   * concrete class directly instead of going through the virtual table
+   * (twice for adapters of bidirectional reactions). GENERIC reactions
+   * fall back on virtual calls.
+   */
+  enum Type { GENERIC, FORWARD_CHEMICAL, BACKWARD_CHEMICAL,
+	      FORWARD_BINDING, BACKWARD_BINDING, TRANSLOCATION,
+	      PRODUCT_LOADING, DOUBLE_STRAND_LOADING, RELEASE,
+	      DOUBLE_STRAND_RECRUITMENT };
 
   // ==========================
   //  Constructors/Destructors
@@ -56,8 +68,9 @@ public:
   //
   /**
    * @brief Default constructor
+   * @param type Concrete type of the reaction.
    */
-  Reaction (void);
+  Reaction (Type type = GENERIC);
 
   // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
@@ -124,6 +137,12 @@ public:
    */
   long long int number_performed (void) const;
 
+  /**
+   * @brief Accessor to concrete type of reaction.
+   * @return Tag of the concrete class of the reaction.
+   */
+  Type type (void) const;
+
   /**
    * @brief Accessor to name of reaction
    * @return Name of reaction (empty string by default).
@@ -140,6 +159,21 @@ public:
 				   const Reaction& reaction);
   
  protected:
+  // ===================
+  //  Protected Methods
+  // ===================
+  //
+  /**
+   * @brief Type of an adapter accessing one direction of a reaction.
+   * @param reaction BidirectionalReaction accessed by the adapter.
+   * @param forward True for the forward direction, false for the backward
+   *  direction.
+   * @return Tag matching the concrete class of the bidirectional reaction,
+   *  GENERIC if it is not known.
+   */
+  static Type adapter_type (const BidirectionalReaction& reaction,
+			    bool forward);
+
   // ============
   //  Attributes
   // ============
@@ -182,6 +216,8 @@ public:
   long long int _number_performed;
   /** @brief Name of reaction (optional). */
   std::string _name;
+  /** @brief Concrete type of reaction. */
+  Type _type;
 };
 
 // ======================
@@ -190,18 +226,11 @@ public:
 //
 #include "macros.h" // ENSURE ()
 
-inline Reaction::Reaction (void)
-  : _rate (0), _number_performed (0)
+inline Reaction::Reaction (Type type)
+  : _rate (0), _number_performed (0), _type (type)
 {
 }
 
-inline void Reaction::update_rate (void)
-{
-  _rate = compute_rate();
-  /** @post Rate must be positive. */
-  ENSURE (_rate >= 0);
-}
-
 inline void Reaction::set_name (const std::string& name)
 {
   _name = name;
@@ -217,12 +246,6 @@ inline const std::vector<Reactant*>& Reaction::reactants (void) const
   return _reactants;
 }
 
-inline void Reaction::perform (void)
-{
-  ++_number_performed;
-  do_reaction();
-}
-
 inline std::ostream& operator<< (std::ostream& output, const Reaction& reaction)
 {
   reaction.print (output);
@@ -239,4 +262,9 @@ inline const std::string& Reaction::name (void) const
   return _name;
 }
 
+inline Reaction::Type Reaction::type (void) const
+{
+  return _type;
+}
+
 #endif // REACTION_H
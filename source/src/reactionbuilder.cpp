@@ -89,6 +89,7 @@ TranslocationBuilder::TranslocationBuilder (CellState& cell_state)
   , _format (TagToken ("Translocation") + StrToken (_processive_name)
 	     + StrToken (_step_name) + StrToken (_stalled_name) 
 	     + IntToken (_step_size) + DblToken (_rate))
+  , _leap_format (TagToken ("leap") + IntToken (_leap_length))
 {
 }
 
@@ -170,10 +171,21 @@ bool DoubleStrandLoadingBuilder::match (InputLine& text_input)
 bool TranslocationBuilder::match (InputLine& text_input)
 {
   if (!_format.match (text_input)) { return false; }
+  _leap_length = 1;
+  if (_leap_format.match (text_input))
+    {
+      if ((_leap_length < 1) 
+	  || ((_leap_length > 1) && (_step_name != _processive_name)))
+	{
+	  throw ParserException ("Leap length must be strictly positive and "
+				 "leaping translocations must step back to "
+				 "their processive form");
+	}
+    }
   store_and_name (new Translocation (fetch <BoundChemical> (_processive_name), 
 				     fetch <BoundChemical> (_step_name), 
 				     fetch <BoundChemical> (_stalled_name),
-				     _step_size, _rate),
+				     _step_size, _rate, _leap_length),
 		  text_input.line());
   return true;
 }
@@ -193,9 +193,9 @@ class TranslocationBuilder : public ReactionBuilder
 
  private:
   // format and values read
-  Rule _format;
+  Rule _format, _leap_format;
   std::string _processive_name, _step_name, _stalled_name;
-  int _step_size;
+  int _step_size, _leap_length;
   double _rate;
 };
 
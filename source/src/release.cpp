@@ -45,7 +45,8 @@ Release::Release (BoundChemical& releasing_polymerase,
 		  BoundChemical& empty_polymerase,
 		  BoundChemical& fail_polymerase,
 		  const ProductTable& product_table, double rate)
-  : _releasing_polymerase (releasing_polymerase)
+  : Reaction (RELEASE)
+  , _releasing_polymerase (releasing_polymerase)
   , _empty_polymerase (empty_polymerase)
   , _fail_polymerase (fail_polymerase)
   , _product_table (product_table)
@@ -84,8 +84,9 @@ void SequenceBinding::perform_forward (void)
   // A binding site in the family is randomly chosen and occupied by a newly
   // created binding result
   const BindingSite& site = _family.random_available_site();
-  _binding_result.add (BoundUnitFactory::instance().create (site));
-  site.location().bind_unit (site.first(), site.last());
+  BoundUnit& unit = BoundUnitFactory::instance().create (site);
+  _binding_result.add (unit);
+  site.location().bind_unit (unit);
 }
 
 void SequenceBinding::perform_backward (void)
@@ -100,7 +101,7 @@ void SequenceBinding::perform_backward (void)
   BoundUnit& unit = _family_filter.random_unit();
 
   // remove unit
-  unit.location().unbind_unit (unit.first(), unit.last());
+  unit.location().unbind_unit (unit);
   _binding_result.remove (unit);
   BoundUnitFactory::instance().free (unit);
 }
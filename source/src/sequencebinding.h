@@ -105,6 +105,9 @@ public:
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // Redefined from BidirectionReaction
   double compute_forward_rate (void) const;
   double compute_backward_rate (void) const;
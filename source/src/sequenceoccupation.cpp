@@ -29,7 +29,6 @@
 //
 #include "sequenceoccupation.h"
 #include "bindingsite.h"
-#include "sitegroup.h"
 #include "partialstrand.h"
 #include "macros.h"
 
@@ -39,8 +38,8 @@
 //
 SequenceOccupation::SequenceOccupation (int length)
   : _number_sequences (0)
-  , _number_segments (length, 0)
-  , _occupancy (length, 0)
+  , _negated_segments (length)
+  , _occupancy (length)
 {
 }
 
@@ -50,8 +49,6 @@ SequenceOccupation::SequenceOccupation (int length)
 
 SequenceOccupation::~SequenceOccupation (void)
 {
-  for (std::size_t i = 0; i < _site_groups.size(); ++i)
-    { delete _site_groups[i]; }
   for (std::vector <PartialStrand*>::iterator strand_it 
 	 = _partials.begin();
        strand_it != _partials.end(); ++strand_it)
@@ -72,7 +69,7 @@ void SequenceOccupation::add_element (int first, int last)
   REQUIRE (first <= last);
 
   // update occupancy status
-  for (int i = first; i <= last; i++) { _occupancy [i] += 1; }
+  _occupancy.add (first, last, 1);
 
   // notify change
   notify_change (first, last);
@@ -88,19 +85,55 @@ void SequenceOccupation::remove_element (int first, int last)
   REQUIRE (first <= last);
 
   // update occupancy status
-  for (int i = first; i <= last; i++) { _occupancy [i] -= 1; }  
+  _occupancy.add (first, last, -1);
 
   // notify change
   notify_change (first, last);
 }
 
+void SequenceOccupation::move_element (int first, int last, int step)
+{
+  /** @pre first must be within sequence bound. */
+  REQUIRE ((first >= 0) && (first < _occupancy.size()));
+  /** @pre last must be within sequence bound. */
+  REQUIRE ((last >= 0) && (last < _occupancy.size()));
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+  /** @pre Moved element must be within sequence bound. */
+  REQUIRE ((first + step >= 0) && (last + step < _occupancy.size()));
+
+  int new_first = first + step;
+  int new_last = last + step;
+  if ((new_first > last) || (new_last < first))
+    {
+      // no overlap between old and new positions
+      remove_element (first, last);
+      add_element (new_first, new_last);
+      return;
+    }
+
+  // update occupancy status of trailing and leading edges only
+  if (step > 0)
+    {
+      _occupancy.add (first, new_first-1, -1);
+      _occupancy.add (last+1, new_last, 1);
+      notify_change (first, new_last);
+    }
+  else if (step < 0)
+    {
+      _occupancy.add (new_last+1, last, -1);
+      _occupancy.add (new_first, first-1, 1);
+      notify_change (new_first, last);
+    }
+}
+
 void SequenceOccupation::add_sequence (int quantity)
 {
   /** @pre quantity must be positive. */
   REQUIRE (quantity >= 0);
 
   _number_sequences += quantity;
-  notify_all_sites();
+  notify_population_change (quantity);
 }
 
 void SequenceOccupation::remove_sequence (int quantity)
@@ -109,7 +142,7 @@ void SequenceOccupation::remove_sequence (int quantity)
   REQUIRE (quantity <= _number_sequences);
 
   _number_sequences -= quantity;
-  notify_all_sites();
+  notify_population_change (-quantity);
 }
 
 bool SequenceOccupation::extend_strand (int strand_id, int position)
@@ -127,8 +160,8 @@ bool SequenceOccupation::extend_strand (int strand_id, int position)
 
   if (_partials [strand_id]->occupied (position)) { return false; }
   _partials [strand_id]->occupy (position);
-  _occupancy [position] -= 1;
-  _number_segments [position] += 1;
+  _occupancy.add (position, position, -1);
+  _negated_segments.add (position, position, -1);
   notify_change (position, position);
   return true;
 }
@@ -139,36 +172,22 @@ void SequenceOccupation::release_strand_id (int strand_id)
   _partial_creation_order.remove (strand_id);
   _unused_partials.push (strand_id);
   ++_number_sequences;
-  for (std::size_t i = 0; i < _occupancy.size(); ++i) 
-    { ++_occupancy [i]; _number_segments [i] -= 1; }
+  _occupancy.add (0, _occupancy.size()-1, 1);
+  _negated_segments.add (0, _occupancy.size()-1, 1);
 }
 
 void SequenceOccupation::watch_site (BindingSite& site)
 {
-  // look if site should be added to an existing group
-  bool new_group = true;
-  std::size_t ind_g = position_to_group (site.first());
-  if (ind_g < _site_groups.size())
-    {
-      SiteGroup* g = _site_groups [ind_g];
-      if (site.overlaps (g->first(), g->last()))
-	{
-	  // add to group and look whether it overlaps with the following groups
-	  g->add_site (site);
-	  fuse_groups (ind_g);
-	  new_group = false;
-	}
-    }
-  if (new_group == true)
+  _sites.add_site (site);
+
+  // register family for changes in the number of sequences
+  bool new_family = true;
+  for (std::size_t i = 0; i < _population_watchers.size(); ++i)
     {
-      // create and insert new group
-      SiteGroup* g = new SiteGroup;
-      g->add_site (site);
-      if (ind_g < _site_groups.size())
-	{ _site_groups.insert (_site_groups.begin()+ind_g, g); }
-      else
-	{ _site_groups.push_back (g); }
+      if (&_population_watchers [i]->family() == &site.family())
+	{ new_family = false; break; }
     }
+  if (new_family) { _population_watchers.push_back (&site); }
 
   // send first notification about site availability
   site.update();
@@ -187,12 +206,15 @@ int SequenceOccupation::number_sites (int first, int last) const
   /** @pre first must be smaller or equal to last. */
   REQUIRE (first <= last);
 
-  int min = _number_segments [first];
-  for (int i = first+1; i <= last; ++i)
-    {
-      if (_number_segments [i] < min) { min = _number_segments [i]; }
-    }
-  return _number_sequences + min;
+  return _number_sequences - _negated_segments.max (first, last);
+}
+
+bool SequenceOccupation::has_binding_site (int first, int last) const
+{
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+
+  return _sites.overlaps (first, last);
 }
 
 int SequenceOccupation::number_available_sites (int first, int last) const
@@ -204,16 +226,23 @@ int SequenceOccupation::number_available_sites (int first, int last) const
   /** @pre first must be smaller or equal to last. */
   REQUIRE (first <= last);
 
-  int max_occupied = _occupancy [first];
-  for (int i = first+1; i <= last; ++i)
-    {
-      if (_occupancy [i] > max_occupied) { max_occupied = _occupancy [i]; }
-    }
-  int result = _number_sequences - max_occupied;
+  int result = availability_level (first, last);
   if (result < 0) { return 0; }
   return result;
 }
 
+int SequenceOccupation::availability_level (int first, int last) const
+{
+  /** @pre first must be within sequence bound. */
+  REQUIRE ((first >= 0) && (first < _occupancy.size()));
+  /** @pre last must be within sequence bound. */
+  REQUIRE ((last >= 0) && (last < _occupancy.size()));
+  /** @pre first must be smaller or equal to last. */
+  REQUIRE (first <= last);
+
+  return _number_sequences - _occupancy.max (first, last);
+}
+
 int SequenceOccupation::partial_strand_id (int position) const
 {
   /** @pre position must be within sequence bound. */
@@ -256,54 +285,13 @@ std::list <std::vector <int> > SequenceOccupation::partial_strands (void) const
 //  Private Methods
 // =================
 //
-void SequenceOccupation::fuse_groups (std::size_t index)
-{
-  // if group is last in vector no fusion with a follower is possible
-  if (index >= _site_groups.size()-1) return;
-
-  // fuse if group overlaps with the following one
-  if (_site_groups [index]->last() < _site_groups [index+1]->first())
-    { return; }
-  _site_groups [index]->absorb (*_site_groups [index+1]);
-  delete _site_groups [index+1];
-  _site_groups.erase (_site_groups.begin() + index+1);
-  fuse_groups (index);
-}
-
-std::size_t SequenceOccupation::position_to_group (int position) const
-{
-  if (_site_groups.size() == 0) { return 1; }
-  if (_site_groups[0]->last() >= position) { return 0; }
-
-  // we look for the largest i such that
-  //  _site_groups[i].last() < position
-  std::size_t i_min = 0;
-  std::size_t i_max = _site_groups.size()-1;
-  std::size_t i;
-  while (i_min < i_max)
-    {
-      i = (i_min + i_max + 1)/2;
-      if (_site_groups[i]->last() >= position) { i_max = i-1; }
-      else { i_min = i; }
-    }
-
-  // we return the next group that may contain position, i.e. i+1
-  return i_min+1;
-}
-
 void SequenceOccupation::notify_change (int a, int b) const
 {
-  if (_site_groups.size() > 0)
-    {
-      std::size_t last_group = position_to_group (b);
-      if (last_group == _site_groups.size()) { --last_group; }
-      for (std::size_t i = position_to_group (a); i <= last_group; ++i)
-	{ _site_groups [i]->update (a, b); }
-    }
+  _sites.update (a, b);
 }
 
-void SequenceOccupation::notify_all_sites (void) const
+void SequenceOccupation::notify_population_change (int delta) const
 {
-  for (std::size_t i = 0; i < _site_groups.size(); ++i)
-    { _site_groups [i]->update_all(); }
+  for (std::size_t i = 0; i < _population_watchers.size(); ++i)
+    { _population_watchers [i]->update_population (delta); }
 }
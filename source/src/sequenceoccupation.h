@@ -34,6 +34,8 @@
 // ======================
 //
 #include "forwarddeclarations.h"
+#include "rangemaxtree.h"
+#include "bindingsiteindex.h"
 
 /**
  * @brief Class handling occupation levels on ChemicalSequence.
@@ -86,6 +88,17 @@ class SequenceOccupation
    */
   void remove_element (int first, int last);
 
+  /**
+   * @brief Register element moved along the sequence.
+   * @param first First base occupied by element before move.
+   * @param last Last base occupied by element before move.
+   * @param step Number of bases by which the element moves (negative values
+   *  move towards the start of the sequence).
+   * @details Only bases entering or leaving the element footprint are
+   *  updated and sites are notified once for the whole range covered.
+   */
+  void move_element (int first, int last, int step);
+
   /**
    * @brief Register new sequence instances added to the pool.
    * @param quantity Number of instances of sequence added to pool.
@@ -138,6 +151,23 @@ class SequenceOccupation
    */
   int number_available_sites (int first, int last) const;
 
+  /**
+   * @brief Check whether a watched binding site overlaps a segment.
+   * @param first Starting position of the segment.
+   * @param last Ending position of the segment.
+   * @return True if at least one binding site overlaps the segment.
+   */
+  bool has_binding_site (int first, int last) const;
+
+  /**
+   * @brief Compute the availability level of a site.
+   * @param first Starting position of the site.
+   * @param last Ending position of the site.
+   * @return Number of unoccupied sites, negative if the site is occupied
+   *  more times than there are sequences.
+   */
+  int availability_level (int first, int last) const;
+
   /**
    * @brief Accessor to partial strand at given position.
    * @param position Position of interest.
@@ -168,17 +198,6 @@ private:
   //  Private Methods
   // =================
   //
-  /**
-   * @brief Convert a position along the sequence to a wtcher group index.
-   * @param position Position along the sequence.
-   * @return Index of the SiteGroup that contains this position (as site
-   *  groups are non-overlapping, it is necessarily unique). If no group
-   *  contains the position, returns the index of the next group along the
-   *  sequence or the number of groups if there are no groups between the 
-   *  position and the end of the sequence.
-   */
-  std::size_t position_to_group (int position) const;
-
   /**
    * @brief Send notifications knowing that a change occurred between two
    *  precise positions.
@@ -188,20 +207,11 @@ private:
   void notify_change (int a, int b) const;
 
   /**
-   * @brief Send notifications to all sites due to a global change.
-   */
-  void notify_all_sites (void) const;
-
-  /**
-   * @brief Fuse overlapping site groups starting from a specific index.
-   * @param index Index of the group to start the fusion from, typically a group
-   *  that was just extended towards the end of the sequence.
-   *
-   *  This function should be called whenever a group is extended. It tries to
-   *  fuse the group recursively with following groups, as it assumes that the
-   *  first group was extended towards the end of the sequence.
+   * @brief Send notifications to site families due to a change in the
+   *  number of sequences.
+   * @param delta Change in the number of sequences.
    */
-  void fuse_groups (std::size_t index);
+  void notify_population_change (int delta) const;
 
   // ============
   //  Attributes
@@ -210,14 +220,23 @@ private:
   /** @brief Number of sequences in the pool. */
   int _number_sequences;
 
-  /** @brief Tracks number of segments spanning each base. */
-  std::vector <int> _number_segments;
+  /**
+   * @brief Tracks number of segments spanning each base (stored with
+   *  opposite sign so that the minimum over a site is a range maximum).
+   */
+  RangeMaxTree _negated_segments;
 
   /** @brief Tracks occupied positions along the sequence. */
-  std::vector <int> _occupancy;
+  RangeMaxTree _occupancy;
+
+  /** @brief Sites whose availability needs to be maintained. */
+  BindingSiteIndex _sites;
 
-  /** @brief Groups of sites whose availability needs to be maintained. */
-  std::vector <SiteGroup*> _site_groups;
+  /**
+   * @brief One site per family located on the sequence, notified when the
+   *  number of sequences changes.
+   */
+  std::vector <BindingSite*> _population_watchers;
 
   /** @brief Vector of partial strands (access by identifier). */
   std::vector <PartialStrand*> _partials;  
@@ -24,6 +24,7 @@
 #include <vector> // std::vector
 #include <iostream> // std::cout
 #include <stdexcept> // std::runtime_error
+#include <ctime> // clock()
 
 // ==================
 //  Project Includes
@@ -41,6 +42,7 @@
 #include "parser.h"
 #include "randomhandler.h"
 #include "doublestrand.h"
+#include "translocation.h"
 #include "macros.h"
 
 // ==========================
@@ -53,39 +55,33 @@ Simulation::Simulation (const std::string& filename)
   , _next_log_time (0)
   , _next_timing (0)
   , _next (EVENT)
+  , _next_leap (0)
 {
-  RandomHandler::instance().set_seed (_params.seed());
-
-  // read input files and create units, reactions and events
-  InputData input_data (_params.input_files());
-  Parser parser (_cell_state, _event_handler);
-  parser.parse (input_data);
-  std::cout << "Loaded system containing "
-	    << _cell_state.number_chemicals() << " chemicals and "
-	    << _cell_state.reactions().size() << " reactions."
-	    << std::endl;
-
-  // set volume parameters
-  _cell_state.set_volume_parameters (_params.base_volume(),
-				     _params.volume_modifiers(),
-				     _params.volume_weights());
-  _next_volume_time = _params.initial_time() + _params.volume_step();
-
-  // create solver
-  _solver = _params.solver_factory().create (_params, _cell_state);
-
-  // set next log time and create loggers
-  _next_log_time = _params.initial_time();
+  if (_params.automatic_drawing_algorithm())
+    { _params.set_drawing_algorithm (calibrate_drawing_algorithm (filename)); }
+  initialize();
   create_loggers();
 
-  // ignore all events preceding simulation start
-  while (_event_handler.next_event_time() < _params.initial_time())
-    { _event_handler.ignore_event(); }
-
   // initialize run
   compute_next_timing();
 }
 
+Simulation::Simulation (const std::string& filename,
+			const std::string& drawing_algorithm)
+  : _params (filename, true)
+  , _solver (0)
+  , _next_log_time (0)
+  , _next_timing (0)
+  , _next (EVENT)
+  , _next_leap (0)
+{
+  _params.set_drawing_algorithm (drawing_algorithm);
+  initialize();
+
+  // initialize run (without loggers)
+  compute_next_timing();
+}
+
 // Forbidden
 // Simulation::Simulation (const Simulation& other_simulation);
 // Simulation& Simulation::operator= (const Simulation& other_simulation);
@@ -134,12 +130,19 @@ void Simulation::perform_next_reaction (void)
         { _solver->reschedule (_next_timing); }
       _next_volume_time += _params.volume_step();
     }
+    else if (_next == LEAP)
+    {
+      write_logs (_next_timing);
+      _leaping_translocations [_next_leap]->complete_leap();
+      _solver->reschedule (_next_timing);
+    }
     compute_next_timing();
   }
   if (_next_timing < _params.final_time())
     {
       write_logs (_next_timing);
       _solver->perform_next_reaction();
+      schedule_leaps();
       compute_next_timing();
     }
   else
@@ -158,6 +161,7 @@ void Simulation::skip (double time_)
     { _event_handler.perform_event(); }
   while (_next_volume_time < time_)
     { _next_volume_time += _params.volume_step(); }
+  complete_leaps (time_);
   _cell_state.update_volume();
   _solver->reschedule (time_);
   compute_next_timing();
@@ -198,6 +202,95 @@ void Simulation::reset_ignored_variation (const std::string& name)
 //  Private Methods
 // =================
 //
+const int Simulation::CALIBRATION_STEPS;
+
+void Simulation::initialize (void)
+{
+  RandomHandler::instance().set_seed (_params.seed());
+
+  // read input files and create units, reactions and events
+  if (!_params.quiet()) 
+    { std::cout << "Opening input files... " << std::endl; }
+  InputData input_data (_params.input_files());
+  Parser parser (_cell_state, _event_handler);
+  if (!_params.quiet()) { std::cout << "Parsing data..." << std::endl; }
+  parser.parse (input_data);
+  if (!_params.quiet())
+    {
+      std::cout << "Loaded system containing "
+		<< _cell_state.number_chemicals() << " chemicals and "
+		<< _cell_state.reactions().size() << " reactions."
+		<< std::endl;
+    }
+
+  // set volume parameters
+  _cell_state.set_volume_parameters (_params.base_volume(),
+				     _params.volume_modifiers(),
+				     _params.volume_weights());
+  _next_volume_time = _params.initial_time() + _params.volume_step();
+
+  // create solver
+  _solver = _params.solver_factory().create (_params, _cell_state);
+
+  // leap completions are scheduled alongside events
+  const std::vector <Reaction*>& reactions = _cell_state.reactions();
+  for (std::size_t i = 0; i < reactions.size(); ++i)
+    {
+      if (reactions [i]->type() != Reaction::TRANSLOCATION) { continue; }
+      Translocation* translocation 
+	= static_cast <Translocation*> (reactions [i]);
+      if (translocation->leap_length() > 1) 
+	{ _leaping_translocations.push_back (translocation); }
+    }
+
+  // set next log time
+  _next_log_time = _params.initial_time();
+
+  // ignore all events preceding simulation start
+  while (_event_handler.next_event_time() < _params.initial_time())
+    { _event_handler.ignore_event(); }
+}
+
+std::string
+Simulation::calibrate_drawing_algorithm (const std::string& filename) const
+{
+  static const char* algorithms[] = { "vector", "sorting", "tree", "ktree",
+					  "hybrid" };
+  std::cout << "Calibrating drawing algorithm..." << std::endl;
+  std::string best_algorithm;
+  double best_throughput = -1;
+  for (std::size_t i = 0; i < sizeof (algorithms) / sizeof (algorithms[0]);
+       ++i)
+    {
+      Simulation trial (filename, algorithms [i]);
+      double throughput = trial.calibration_run (CALIBRATION_STEPS);
+      std::cout << "Calibration: " << algorithms [i] << " performed "
+		<< throughput << " reactions per second." << std::endl;
+      if (throughput > best_throughput)
+	{
+	  best_throughput = throughput;
+	  best_algorithm = algorithms [i];
+	}
+    }
+  std::cout << "Selected drawing algorithm " << best_algorithm << "."
+	    << std::endl;
+  return best_algorithm;
+}
+
+double Simulation::calibration_run (int number_reactions)
+{
+  clock_t t = clock();
+  long long int initial_reactions = _solver->number_reactions_performed();
+  while ((_solver->number_reactions_performed() - initial_reactions
+	  < number_reactions)
+	 && (_next_timing < _params.final_time()))
+    { perform_next_reaction(); }
+  t = clock() - t;
+  if (t == 0) { t = 1; }
+  return (_solver->number_reactions_performed() - initial_reactions)
+    * double (CLOCKS_PER_SEC) / t;
+}
+
 void Simulation::create_loggers (void)
 {
   // create reactant and doublestrand loggers
@@ -262,6 +355,15 @@ void Simulation::compute_next_timing (void)
       _next_timing = _next_volume_time;
       _next = VOLUME;
     }
+  for (std::size_t i = 0; i < _leaping_translocations.size(); ++i)
+    {
+      if (_leaping_translocations [i]->next_leap_time() < _next_timing)
+	{
+	  _next_timing = _leaping_translocations [i]->next_leap_time();
+	  _next = LEAP;
+	  _next_leap = i;
+	}
+    }
   if (_solver->next_reaction_time() < _next_timing)
     {
       _next_timing = _solver->next_reaction_time();
@@ -269,6 +371,21 @@ void Simulation::compute_next_timing (void)
     }
 }
 
+void Simulation::schedule_leaps (void)
+{
+  for (std::size_t i = 0; i < _leaping_translocations.size(); ++i)
+    { _leaping_translocations [i]->schedule_leaps (_solver->time()); }
+}
+
+void Simulation::complete_leaps (double time)
+{
+  for (std::size_t i = 0; i < _leaping_translocations.size(); ++i)
+    {
+      while (_leaping_translocations [i]->next_leap_time() < time)
+	{ _leaping_translocations [i]->complete_leap(); }
+    }
+}
+
 void Simulation::write_logs (double t)
 {
   while (t >= _next_log_time)
@@ -277,5 +394,8 @@ void Simulation::write_logs (double t)
 	         it != _loggers.end(); ++it)
 	      { (*it)->log (_next_log_time); }
       _next_log_time += _params.output_step();
+
+      // reorganizing rates between outputs keeps it out of reaction loop
+      _solver->reshape_rates();
     }
 }
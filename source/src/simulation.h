@@ -26,6 +26,7 @@
 // ==================
 //
 #include <list> // std::list
+#include <vector> // std::vector
 
 // ==================
 //  Project Includes
@@ -61,6 +62,15 @@ class Simulation
   /** @brief Assignment operator. */
   Simulation& operator= ( const Simulation& other_simulation );
 
+  /**
+   * @brief Constructor of calibration runs (no output is written).
+   * @param filename Path to parameter file.
+   * @param drawing_algorithm Drawing algorithm to use instead of the one
+   *  specified in the parameter file.
+   */
+  Simulation (const std::string& filename,
+	      const std::string& drawing_algorithm);
+
  public:
   /**
    * @brief Destructor.
@@ -133,9 +143,39 @@ private:
   //  Private Methods
   // =================
   //
+  /**
+   * @brief Create system from parameters, without loggers.
+   */
+  void initialize (void);
+
+  /**
+   * @brief Find drawing algorithm yielding highest throughput.
+   * @param filename Path to parameter file.
+   * @return Name of drawing algorithm performing most reactions per second
+   *  over a short run starting from initial state.
+   */
+  std::string calibrate_drawing_algorithm (const std::string& filename) const;
+
+  /**
+   * @brief Perform reactions and measure throughput.
+   * @param number_reactions Number of reactions to perform (less if final
+   *  simulation time is reached).
+   * @return Number of reactions performed per CPU second.
+   */
+  double calibration_run (int number_reactions);
+
   /** @brief Compute type and time of next event or reaction. */
   void compute_next_timing (void);
 
+  /** @brief Date leaps started by last reaction. */
+  void schedule_leaps (void);
+
+  /**
+   * @brief Complete leaps ending before a given time.
+   * @param time Time until which leaps should be completed.
+   */
+  void complete_leaps (double time);
+
   /** @brief Write logs if necessary. */
   void write_logs (double time);
 
@@ -156,6 +196,8 @@ private:
   EventHandler _event_handler;
   /** @brief List of loggers. */
   std::list <Logger*> _loggers;
+  /** @brief Translocations whose units may leap. */
+  std::vector <Translocation*> _leaping_translocations;
 
   /** @brief Next log time. */
   double _next_log_time;
@@ -164,9 +206,14 @@ private:
   /** @brief Next timing of reaction, event, volume change, etc. */
   double _next_timing;
   /** @brief Possible types for next occurrence (reaction, event, etc.). */
-  enum NextType { REACTION, EVENT, VOLUME };
+  enum NextType { REACTION, EVENT, VOLUME, LEAP };
   /** @brief Type of next occurrence (reaction, event, etc.). */
   NextType _next;
+  /** @brief Index of translocation whose leap ends next (if _next is LEAP). */
+  int _next_leap;
+
+  /** @brief Number of reactions per calibration run. */
+  static const int CALIBRATION_STEPS = 5000;
 };
 
 // ======================
@@ -37,6 +37,8 @@
 #include "solverfactory.h"
 #include "ratemanagerfactory.h"
 #include "ratecontainerfactory.h"
+#include "reactionclassification.h"
+#include "macros.h"
 
 // ===================
 //  Static attributes
@@ -49,8 +51,14 @@ const std::string SimulationParams::_input_files_tag = "INPUT_FILES";
 const std::string SimulationParams::_output_dir_tag = "OUTPUT_DIR";
 const std::string SimulationParams::_output_step_tag = "OUTPUT_STEP";
 const std::string SimulationParams::_output_entities_tag = "OUTPUT_ENTITIES";
+const std::string SimulationParams::_solver_tag = "SOLVER";
+const std::string SimulationParams::_reaction_class_tag = "REACTION_CLASS";
+const std::string SimulationParams::_adaptive_dispatch_tag = "ADAPTIVE_DISPATCH";
+const std::string SimulationParams::_reaction_order_tag = "REACTION_ORDER";
 const std::string SimulationParams::_drawing_algorithm_tag = "DRAWING_ALGORITHM";
 const std::string SimulationParams::_hybrid_base_rate_tag = "HYBRID_BASE_RATE";
+const std::string SimulationParams::_tree_rebuild_interval_tag
+= "TREE_REBUILD_INTERVAL";
 const std::string SimulationParams::_base_volume_tag = "BASE_VOLUME";
 const std::string SimulationParams::_volume_modifier_tag = "VOLUME_MODIFIER";
 const std::string SimulationParams::_volume_step_tag = "VOLUME_STEP";
@@ -63,18 +71,29 @@ const std::string SimulationParams::_param_file = "params.out";
 //  Constructors/Destructors
 // ==========================
 //
-SimulationParams::SimulationParams (const std::string& filename)
+SimulationParams::SimulationParams (const std::string& filename, bool quiet)
   : _seed (0)
   , _initial_time (0)
   , _final_time (1000)
   , _output_step (1)
-  , _solver_factory (new NaiveSolverFactory())
+  , _solver_factory (0)
+  , _adaptive_tolerance (0)
+  , _adaptive_time_step (0.01)
   , _rate_manager_factory (new DependencyRateManagerFactory())
+  , _reorder_reactions (false)
+  , _rate_container_factory (0)
+  , _automatic_drawing_algorithm (false)
+  , _quiet (quiet)
   , _hybrid_base_rate (1)
+  , _tree_rebuild_interval (0)
   , _base_volume (1)
   , _volume_step (1)
 {
-  std::cout << "Reading parameter file " << filename << "..." << std::endl;
+  if (!_quiet)
+    {
+      std::cout << "Reading parameter file " << filename << "..." 
+		<< std::endl;
+    }
   std::ifstream file (filename.c_str());
   if (file.fail())
     {
@@ -94,11 +113,27 @@ SimulationParams::SimulationParams (const std::string& filename)
   rules.push_back (TagToken (_output_step_tag) + DblToken (_output_step));
   rules.push_back (TagToken (_output_entities_tag) 
 		   + Iteration (MemToken <std::string> (_output_entities)));
+  std::string solver ("naive");
+  rules.push_back (TagToken (_solver_tag) + StrToken (solver));
+  std::string class_time_step;
+  std::vector <std::string> class_patterns;
+  std::size_t class_rule = rules.size();
+  rules.push_back (TagToken (_reaction_class_tag) + StrToken (class_time_step)
+		   + Iteration (MemToken <std::string> (class_patterns)));
+  rules.push_back (TagToken (_adaptive_dispatch_tag)
+		   + DblToken (_adaptive_tolerance)
+		   + DblToken (_adaptive_time_step));
+  std::string reaction_order ("input");
+  rules.push_back (TagToken (_reaction_order_tag)
+		   + StrToken (reaction_order));
   std::string rate_container ("hybrid");
   rules.push_back (TagToken (_drawing_algorithm_tag) 
 		    + StrToken (rate_container));
+  std::string base_rate;
   rules.push_back (TagToken (_hybrid_base_rate_tag) 
-		   + DblToken (_hybrid_base_rate));
+		   + StrToken (base_rate));
+  rules.push_back (TagToken (_tree_rebuild_interval_tag)
+		   + IntToken (_tree_rebuild_interval));
   rules.push_back (TagToken (_base_volume_tag) + DblToken (_base_volume));
   rules.push_back (TagToken (_volume_step_tag) + DblToken (_volume_step));
   rules.push_back (TagToken (_volume_modifier_tag)
@@ -121,9 +156,44 @@ SimulationParams::SimulationParams (const std::string& filename)
 			<< "):\n\t" << _line << "\n";
 	      failure = true;
 	    }
+	  else if (std::size_t (it - rules.begin()) == class_rule)
+	    {
+	      if (!interpret_reaction_class (class_time_step, class_patterns))
+		{ failure = true; }
+	      class_patterns.clear();
+	    }
 	}
     }
+  if (!interpret_solver (solver)) { failure = true; }
   if (!interpret_drawing_algorithm (rate_container)) { failure = true; }
+  if (reaction_order == "locality") { _reorder_reactions = true; }
+  else if (reaction_order != "input")
+    {
+      std::cerr << "ERROR: could not read " << _reaction_order_tag
+		<< ", order should be input or locality.\n";
+      failure = true;
+    }
+  if (!base_rate.empty() && !interpret_hybrid_base_rate (base_rate))
+    { failure = true; }
+  if ((_adaptive_tolerance < 0) || (_adaptive_time_step <= 0))
+    {
+      std::cerr << "ERROR: could not read " << _adaptive_dispatch_tag
+		<< ", tolerance should be positive and time step strictly "
+		<< "positive.\n";
+      failure = true;
+    }
+  if (_tree_rebuild_interval < 0)
+    {
+      std::cerr << "ERROR: could not read " << _tree_rebuild_interval_tag
+		<< ", interval should be positive.\n";
+      failure = true;
+    }
+  if ((_tree_rebuild_interval > 0) && (solver == "next_reaction"))
+    {
+      std::cerr << "ERROR: could not read " << _tree_rebuild_interval_tag
+		<< ", next_reaction solver does not draw from rate trees.\n";
+      failure = true;
+    }
   if (failure)
     {
       std::ostringstream message;
@@ -131,7 +201,7 @@ SimulationParams::SimulationParams (const std::string& filename)
 	      << "file " << filename;
       throw std::runtime_error (message.str());
     }
-  _write_params_out();
+  if (!_quiet) { _write_params_out(); }
 }
 
 // Forbidden
@@ -150,6 +220,17 @@ SimulationParams::~SimulationParams (void)
 //  Public Methods - Commands
 // ===========================
 //
+void SimulationParams::set_drawing_algorithm (const std::string& tag)
+{
+  /** @pre tag must be a valid drawing algorithm other than auto. */
+  REQUIRE (tag != "auto");
+  delete _rate_container_factory;
+  _rate_container_factory = 0;
+  interpret_drawing_algorithm (tag);
+  /** @post Rate container factory must have been created. */
+  ENSURE (_rate_container_factory != 0);
+  if (!_quiet) { _write_params_out(); }
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -179,8 +260,18 @@ bool SimulationParams::interpret_drawing_algorithm (const std::string& tag)
     { _rate_container_factory = new RateVectorFactory;  }
   else if (tag == "tree") 
     { _rate_container_factory = new RateTreeFactory; }
+  else if (tag == "ktree") 
+    { _rate_container_factory = new KaryRateTreeFactory; }
+  else if (tag == "sorting") 
+    { _rate_container_factory = new SortingRateVectorFactory; }
   else if (tag == "hybrid") 
     { _rate_container_factory = new HybridRateContainerFactory;  }
+  else if (tag == "auto")
+    {
+      // placeholder until calibration picks the fastest algorithm
+      _automatic_drawing_algorithm = true;
+      _rate_container_factory = new HybridRateContainerFactory;
+    }
   else
     {
       std::cerr << "ERROR: could not read " 
@@ -190,6 +281,62 @@ bool SimulationParams::interpret_drawing_algorithm (const std::string& tag)
   return true;
 }
 
+bool SimulationParams::interpret_hybrid_base_rate (const std::string& value)
+{
+  std::istringstream value_stream (value);
+  if (value == "auto") { _hybrid_base_rate = 0; }
+  else if (!(value_stream >> _hybrid_base_rate) || (_hybrid_base_rate <= 0))
+    {
+      std::cerr << "ERROR: could not read " << _hybrid_base_rate_tag
+		<< ", base rate should be a strictly positive value or "
+		<< "auto.\n";
+      return false;
+    }
+  return true;
+}
+
+bool SimulationParams::interpret_solver (const std::string& tag)
+{
+  if (tag == "naive") 
+    { _solver_factory = new NaiveSolverFactory;  }
+  else if (tag == "manual_dispatch") 
+    { _solver_factory = new ManualDispatchSolverFactory; }
+  else if (tag == "next_reaction") 
+    { _solver_factory = new NextReactionSolverFactory;  }
+  else
+    {
+      std::cerr << "ERROR: could not read " 
+		<< _solver_tag << ", unknown solver.\n";
+      return false;
+    }
+  return true;
+}
+
+bool SimulationParams::
+interpret_reaction_class (const std::string& time_step,
+			  const std::vector <std::string>& patterns)
+{
+  double step = ReactionClassification::ALWAYS_UPDATED();
+  std::istringstream step_stream (time_step);
+  if ((time_step != "always_updated")
+      && (!(step_stream >> step) || (step <= 0)))
+    {
+      std::cerr << "ERROR: could not read " << _reaction_class_tag
+		<< ", time step should be a positive value or "
+		<< "always_updated.\n";
+      return false;
+    }
+  if (patterns.empty())
+    {
+      std::cerr << "ERROR: could not read " << _reaction_class_tag
+		<< ", no reaction specified.\n";
+      return false;
+    }
+  _reaction_class_time_steps.push_back (step);
+  _reaction_class_patterns.push_back (patterns);
+  return true;
+}
+
 void SimulationParams::_write_params_out (void) const
 {
   std::ofstream file ((_output_dir + "/" + _param_file).c_str());
@@ -208,8 +355,31 @@ void SimulationParams::_write_params_out (void) const
        file_it != _input_files.end(); ++file_it)
     { file << "\n\t" << *file_it; }
   file << "\n";
-  file << _drawing_algorithm_tag << ": " << *_rate_container_factory << "\n";
-  file << _hybrid_base_rate_tag << ": " << _hybrid_base_rate << "\n";
+  file << _solver_tag << ": " << *_solver_factory << "\n";
+  file << _reaction_class_tag << ":";
+  for (std::size_t i = 0; i < _reaction_class_time_steps.size(); ++i)
+    {
+      file << "\n\t";
+      if (_reaction_class_time_steps [i]
+	  == ReactionClassification::ALWAYS_UPDATED())
+	{ file << "always_updated"; }
+      else { file << _reaction_class_time_steps [i]; }
+      for (std::size_t j = 0; j < _reaction_class_patterns [i].size(); ++j)
+	{ file << " " << _reaction_class_patterns [i][j]; }
+    }
+  file << "\n";
+  file << _adaptive_dispatch_tag << ": " << _adaptive_tolerance << " "
+       << _adaptive_time_step << "\n";
+  file << _reaction_order_tag << ": "
+       << (_reorder_reactions ? "locality" : "input") << "\n";
+  file << _drawing_algorithm_tag << ": " << *_rate_container_factory;
+  if (_automatic_drawing_algorithm) { file << " (auto)"; }
+  file << "\n";
+  file << _hybrid_base_rate_tag << ": ";
+  if (_hybrid_base_rate == 0) { file << "auto"; }
+  else { file << _hybrid_base_rate; }
+  file << "\n";
+  file << _tree_rebuild_interval_tag << ": " << _tree_rebuild_interval << "\n";
   file << _base_volume_tag << ": " << _base_volume << "\n";
   file << _volume_step_tag << ": " << _volume_step << "\n";
   file << _volume_modifier_tag << ":";
@@ -49,8 +49,10 @@ class SimulationParams
   /**
    * @brief Constructor from file.
    * @param filename Path to the file to read parameters from.
+   * @param quiet If true, no progress message is displayed and no parameter
+   *  file is written to the output directory (e.g. for calibration runs).
    */
-  SimulationParams (const std::string& filename);
+  SimulationParams (const std::string& filename, bool quiet = false);
 
  private:
   // Forbidden
@@ -69,6 +71,12 @@ class SimulationParams
   //  Public Methods - Commands
   // ===========================
   //
+  /**
+   * @brief Replace drawing algorithm read from parameter file.
+   * @param tag Name of drawing algorithm, as it would appear in the
+   *  parameter file.
+   */
+  void set_drawing_algorithm (const std::string& tag);
 
   // ============================
   //  Public Methods - Accessors
@@ -140,6 +148,37 @@ class SimulationParams
    */
   const SolverFactory& solver_factory (void) const { return *_solver_factory; }
 
+  /**
+   * @brief Accessor to time steps of user-defined reaction classes.
+   * @return Vector of time steps (ReactionClassification::ALWAYS_UPDATED for
+   *  classes that should be always updated). Empty if none specified.
+   */
+  const std::vector <double>& reaction_class_time_steps (void) const
+  { return _reaction_class_time_steps; }
+
+  /**
+   * @brief Accessor to patterns of user-defined reaction classes.
+   * @return Vector of patterns (reaction types or name patterns) defining
+   *  every class. Empty if none specified.
+   */
+  const std::vector < std::vector <std::string> >& 
+  reaction_class_patterns (void) const
+  { return _reaction_class_patterns; }
+
+  /**
+   * @brief Accessor to tolerance used to adapt reaction classes.
+   * @return Maximal relative rate error accepted for reactions integrated with
+   *  constant rates (0 by default, meaning classes are not adapted).
+   */
+  double adaptive_tolerance (void) const { return _adaptive_tolerance; }
+
+  /**
+   * @brief Accessor to time step used to adapt reaction classes.
+   * @return Time interval between two rate samples, also used as time step
+   *  for always updated reactions considered constant (0.01 by default).
+   */
+  double adaptive_time_step (void) const { return _adaptive_time_step; }
+
   /**
    * @brief Accessor to default rate manager factory.
    * @return A factory creating the default type of rate manager to use.
@@ -154,12 +193,40 @@ class SimulationParams
   const RateContainerFactory& rate_container_factory (void) const
   { return *_rate_container_factory; }
 
+  /**
+   * @brief Accessor to reaction ordering.
+   * @return True if rate managers should cluster reactions sharing reactants
+   *  (false by default, reactions are stored in input order).
+   */
+  bool reorder_reactions (void) const { return _reorder_reactions; }
+
+  /**
+   * @brief Accessor to drawing algorithm calibration.
+   * @return True if drawing algorithm should be chosen by calibration runs.
+   */
+  bool automatic_drawing_algorithm (void) const
+  { return _automatic_drawing_algorithm; }
+
+  /**
+   * @brief Accessor to output mode.
+   * @return True if no progress message or output file should be written.
+   */
+  bool quiet (void) const { return _quiet; }
+
   /**
    * @brief Accessor to base rate to use for hybrid method.
-   * @return Base rate to use for hybrid method (1 by default).
+   * @return Base rate to use for hybrid method (1 by default, 0 if it should
+   *  be chosen automatically).
    */
   double hybrid_base_rate (void) const { return _hybrid_base_rate; }
 
+  /**
+   * @brief Accessor to rebuild interval of rate trees.
+   * @return Number of drawings between two reshapings of rate trees from
+   *  drawing frequencies (0 by default, meaning trees stay balanced).
+   */
+  int tree_rebuild_interval (void) const { return _tree_rebuild_interval; }
+
   /**
    * @brief Accessor to base volume value.
    * @return Base value of volume (1 by default).
@@ -204,6 +271,29 @@ private:
    */
   bool interpret_drawing_algorithm (const std::string& tag);
 
+  /**
+   * @brief Interpret base rate of hybrid method.
+   * @param value String input for base rate.
+   * @return True if base rate was successfully converted.
+   */
+  bool interpret_hybrid_base_rate (const std::string& value);
+
+  /**
+   * @brief Interpret solver.
+   * @param tag String input for solver.
+   * @return True if solver was successfully converted.
+   */
+  bool interpret_solver (const std::string& tag);
+
+  /**
+   * @brief Interpret reaction class.
+   * @param time_step String input for time step of the class.
+   * @param patterns Patterns defining reactions belonging to the class.
+   * @return True if reaction class was successfully converted.
+   */
+  bool interpret_reaction_class (const std::string& time_step,
+				 const std::vector <std::string>& patterns);
+
   /**
    * @brief Write relevant simulation parameters to a file for future reference.
    */
@@ -216,8 +306,10 @@ private:
   // various tags used to parse file
   static const std::string _seed_tag, _initial_time_tag, _final_time_tag, 
     _input_files_tag, _output_dir_tag, _output_step_tag, _output_entities_tag, 
-    _drawing_algorithm_tag, _hybrid_base_rate_tag, _base_volume_tag, 
-    _volume_modifier_tag, _volume_step_tag;
+    _solver_tag, _reaction_class_tag, _adaptive_dispatch_tag,
+    _reaction_order_tag, _drawing_algorithm_tag, _hybrid_base_rate_tag,
+    _tree_rebuild_interval_tag,
+    _base_volume_tag, _volume_modifier_tag, _volume_step_tag;
 
   // names for output files
   static const std::string _concentration_file, _param_file, _reaction_file;
@@ -244,12 +336,28 @@ private:
 
   /** @brief Factory for default solver. */
   SolverFactory* _solver_factory;
+  /** @brief Time steps of reaction classes. */
+  std::vector <double> _reaction_class_time_steps;
+  /** @brief Patterns defining reactions belonging to reaction classes. */
+  std::vector < std::vector <std::string> > _reaction_class_patterns;
+  /** @brief Tolerance used to adapt reaction classes. */
+  double _adaptive_tolerance;
+  /** @brief Time step used to adapt reaction classes. */
+  double _adaptive_time_step;
   /** @brief Factory for default rate manager. */
   RateManagerFactory* _rate_manager_factory;
+  /** @brief Whether reactions should be reordered by shared reactants. */
+  bool _reorder_reactions;
   /** @brief Factory for default rate container. */
   RateContainerFactory* _rate_container_factory;
+  /** @brief Whether drawing algorithm should be chosen by calibration. */
+  bool _automatic_drawing_algorithm;
+  /** @brief Whether progress messages and output files are suppressed. */
+  bool _quiet;
   /** @brief Base rate for the HybridRateContainer. */
   double _hybrid_base_rate;
+  /** @brief Rebuild interval for the RateTree. */
+  int _tree_rebuild_interval;
   /** @brief Base volume value. */
   double _base_volume;
 
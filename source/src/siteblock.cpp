@@ -0,0 +1,138 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file siteblock.cpp
+ * @brief Implementation of the SiteBlock class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "siteblock.h"
+#include "ratetree.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+SiteBlock::SiteBlock (void)
+  : _offset (0)
+  , _site_rates (0)
+  , _shifted (true)
+{
+}
+
+// Forbidden
+// SiteBlock::SiteBlock (const SiteBlock& other);
+// SiteBlock& SiteBlock::operator= (const SiteBlock& other);
+
+SiteBlock::~SiteBlock (void)
+{
+  delete _site_rates;
+}
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+int SiteBlock::add_site (int site_index, double k_on, int level)
+{
+  /** @pre k_on must be positive. */
+  REQUIRE (k_on >= 0);
+
+  _site_indices.push_back (site_index);
+  _k_on.push_back (k_on);
+  _levels.push_back (level - _offset);
+  add_to_level (_levels.back(), k_on, 1);
+
+  // rate tree has a fixed size, it is rebuilt at next drawing
+  delete _site_rates;
+  _site_rates = 0;
+  _shifted = true;
+  return _levels.size()-1;
+}
+
+void SiteBlock::set_level (int rank, int level)
+{
+  /** @pre rank must be within block range. */
+  REQUIRE ((rank >= 0) && (rank < _levels.size()));
+
+  int new_level = level - _offset;
+  if (new_level == _levels [rank]) { return; }
+  add_to_level (_levels [rank], -_k_on [rank], -1);
+  add_to_level (new_level, _k_on [rank], 1);
+  _levels [rank] = new_level;
+  if (!_shifted) { _site_rates->set_rate (rank, site_rate (rank)); }
+}
+
+void SiteBlock::shift_levels (int delta)
+{
+  if (delta == 0) { return; }
+  _offset += delta;
+  _shifted = true;
+}
+
+int SiteBlock::random_site (void)
+{
+  if (_shifted)
+    {
+      if (_site_rates == 0) { _site_rates = new RateTree (_levels.size()); }
+      for (int rank = 0; rank < _levels.size(); ++rank)
+	{ _site_rates->set_rate (rank, site_rate (rank)); }
+      _shifted = false;
+    }
+  _site_rates->update_cumulates();
+  return _site_indices [_site_rates->random_index()];
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+double SiteBlock::total_rate (void) const
+{
+  // only levels above -_offset have available sites
+  double result = 0;
+  for (std::map <int, double>::const_iterator
+	 level_it = _k_on_per_level.upper_bound (-_offset);
+       level_it != _k_on_per_level.end(); ++level_it)
+    { result += level_it->second * (level_it->first + _offset); }
+  return result;
+}
+
+// =================
+//  Private Methods
+// =================
+//
+void SiteBlock::add_to_level (int level, double k_on, int count)
+{
+  int& number_sites = _sites_per_level [level];
+  number_sites += count;
+  if (number_sites == 0)
+    {
+      // erase level rather than keeping rounding residues
+      _sites_per_level.erase (level);
+      _k_on_per_level.erase (level);
+    }
+  else { _k_on_per_level [level] += k_on; }
+}
@@ -0,0 +1,183 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file siteblock.h
+ * @brief Header for the SiteBlock class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef SITE_BLOCK_H
+#define SITE_BLOCK_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+#include <map> // std::map
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+
+/**
+ * @brief Class storing binding rates of the sites of a family located on a
+ *  same sequence.
+ *
+ * SiteBlock stores, for each site, its on-rate and its availability level,
+ * i.e. the number of sequences minus the occupancy of the site (negative
+ * values meaning that the site is unavailable). When the number of
+ * sequences changes, all levels are shifted by the same amount: the shift is
+ * recorded in a single offset and site rates are only recomputed when a site
+ * needs to be drawn from the block. The total binding rate of the block is
+ * derived from on-rates cumulated per availability level, so it costs
+ * O(number of distinct levels) instead of O(number of sites). Site rates are
+ * stored in a RateTree, so that drawing a site after a change of occupancy
+ * costs O(logN) where N is the number of sites of the block.
+ */
+class SiteBlock
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Default constructor.
+   */
+  SiteBlock (void);
+
+ private:
+  // Forbidden
+  /** @brief Copy constructor. */
+  SiteBlock (const SiteBlock& other);
+  /** @brief Assignment operator. */
+  SiteBlock& operator= (const SiteBlock& other);
+
+ public:
+  /** @brief Destructor. */
+  ~SiteBlock (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  /**
+   * @brief Add site to block.
+   * @param site_index Identifier of the site (returned when drawing).
+   * @param k_on On-rate of the site.
+   * @param level Current availability level of the site.
+   * @return Index of the site within the block.
+   */
+  int add_site (int site_index, double k_on, int level);
+
+  /**
+   * @brief Update availability level of a site.
+   * @param rank Index of the site within the block.
+   * @param level Current availability level of the site.
+   */
+  void set_level (int rank, int level);
+
+  /**
+   * @brief Shift availability level of all sites.
+   * @param delta Change in the number of sequences.
+   */
+  void shift_levels (int delta);
+
+  /**
+   * @brief Draw a site according to binding rates.
+   * @return Identifier of a site drawn with probability proportional to its
+   *  binding rate.
+   */
+  int random_site (void);
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  /**
+   * @brief Compute total binding rate of the block.
+   * @return Sum of k_on times number of available sites over all sites.
+   */
+  double total_rate (void) const;
+
+private:
+  // =================
+  //  Private Methods
+  // =================
+  //
+  /**
+   * @brief Binding rate of a site.
+   * @param rank Index of the site within the block.
+   * @return k_on times number of available sites.
+   */
+  double site_rate (int rank) const;
+
+  /**
+   * @brief Register on-rate at a given availability level.
+   * @param level Availability level (without offset).
+   * @param k_on On-rate to add (negative to remove).
+   * @param count Number of sites added (negative to remove).
+   */
+  void add_to_level (int level, double k_on, int count);
+
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Identifiers of sites. */
+  std::vector <int> _site_indices;
+
+  /** @brief On-rates of sites. */
+  std::vector <double> _k_on;
+
+  /** @brief Availability levels of sites (without offset). */
+  std::vector <int> _levels;
+
+  /** @brief Shift applied to all availability levels. */
+  int _offset;
+
+  /** @brief Sum of on-rates of sites sharing an availability level. */
+  std::map <int, double> _k_on_per_level;
+
+  /** @brief Number of sites sharing an availability level. */
+  std::map <int, int> _sites_per_level;
+
+  /** @brief Binding rates of sites (used for drawing, built lazily). */
+  RateContainer* _site_rates;
+
+  /** @brief Whether binding rates of sites miss a shift of levels or sites. */
+  bool _shifted;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h" // REQUIRE
+
+inline double SiteBlock::site_rate (int rank) const
+{
+  int available = _levels [rank] + _offset;
+  if (available <= 0) { return 0; }
+  return _k_on [rank] * available;
+}
+
+#endif // SITE_BLOCK_H
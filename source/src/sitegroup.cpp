@@ -1,92 +0,0 @@
-// 
-// Copyright 2017 INRA
-// Authors: M. Dinh, S. Fischer
-// Last modification: 2017-09-19
-// 
-// 
-// Licensed under the GNU General Public License.
-// You should have received a copy of the GNU General Public License
-// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
-// 
-
-
-
-/**
- * @file sitegroup.cpp
- * @brief Implementation of the SiteGroup class.
- * 
- * @authors Marc Dinh, Stephan Fischer
- */
-
-
-// ==================
-//  General Includes
-// ==================
-//
-#include <iostream> // std::cout
-#include <limits> // std::numeric_limits
-
-// ==================
-//  Project Includes
-// ==================
-//
-#include "sitegroup.h"
-#include "bindingsite.h"
-
-// ==========================
-//  Constructors/Destructors
-// ==========================
-//
-SiteGroup::SiteGroup (void)
-  : _first (std::numeric_limits <int>::max())
-  , _last (-1)
-{
-}
-
-// SiteGroup::SiteGroup (const SiteGroup& other);
-// SiteGroup& SiteGroup::operator= (const SiteGroup& other;
-// SiteGroup::~SiteGroup (void);
-
-// ===========================
-//  Public Methods - Commands
-// ===========================
-//
-void SiteGroup::add_site (BindingSite& site)
-{
-  _sites.push_back (&site);
-  if (site.first() < _first) _first = site.first();
-  if (site.last() > _last) _last = site.last();
-
-  if (_sites.size() > 5)
-    {
-      std::cerr << "WARNING: created a site watcher group containing "
-		<< _sites.size() << " elements.\n";
-    }
-}
-
-void SiteGroup::absorb (SiteGroup& other_group)
-{
-  _sites.splice (_sites.end(), other_group._sites);
-  if (other_group._first < _first) _first = other_group._first;
-  if (other_group._last > _last) _last = other_group._last;
-  other_group._first = std::numeric_limits<int>::max();
-  other_group._last = -1;
-
-  if (_sites.size() > 5)
-    {
-      std::cerr << "WARNING: created a site watcher group containing "
-		<< _sites.size() << " elements.\n";
-    }
-}
-
-
-// ============================
-//  Public Methods - Accessors
-// ============================
-//
-
-
-// =================
-//  Private Methods
-// =================
-//
@@ -83,6 +83,14 @@ class Solver
    */
   void reschedule (double time);
 
+  /**
+   * @brief Let rate containers reorganize themselves for faster drawing.
+   *
+   * Meant to be called outside of the reaction loop (e.g. when writing
+   * outputs). Nothing is done by default.
+   */
+  virtual void reshape_rates (void) {}
+
   // ============================
   //  Public Methods - Accessors
   // ============================
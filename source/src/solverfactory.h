@@ -13,8 +13,8 @@
 
 /**
  * @file solverfactory.h
- * @brief Header for the SolverFactory, NaiveSolverFactory and
- *  ManualDispatchSolver classes.
+ * @brief Header for the SolverFactory, NaiveSolverFactory,
+ *  ManualDispatchSolverFactory and NextReactionSolverFactory classes.
  * 
  * @authors Marc Dinh, Stephan Fischer
  */
@@ -30,7 +30,9 @@
 //  General Includes
 // ==================
 //
-
+#include <iostream> // std::ostream
+#include <string> // std::string
+#include <vector> // std::vector
 
 // ==================
 //  Project Includes
@@ -66,6 +68,25 @@ class SolverFactory
    */
   virtual Solver* create (const SimulationParams& params,
 			  CellState& cell_state) const = 0;  
+
+  /**
+   * @brief Standard output.
+   * @return A reference to the stream containing the output.
+   * @param output Stream where output should be written.
+   * @param factory Reference to the factory whose name should be written to 
+   *  output.
+   */
+  friend std::ostream& operator<< (std::ostream& output,
+				   const SolverFactory& factory)
+    { return factory.print(output); }
+
+ private:
+  /**
+   * @brief Print name of class created by factory.
+   * @return A reference to the stream containing the output.
+   * @param output Stream where output should be written.
+   */
+  virtual std::ostream& print (std::ostream& output) const = 0;
 };
 
 /**
@@ -79,10 +100,20 @@ class NaiveSolverFactory : public SolverFactory
   // ===========================
   //
   Solver* create (const SimulationParams& params, CellState& cell_state) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "NaiveSolver"; return output; }
 };
 
 /**
  * @brief Class used to create ManualDispatchSolver.
+ *
+ * Reactions are dispatched among the reaction classes defined in the
+ * simulation parameters: a reaction belongs to the first class containing a
+ * pattern that matches its type or its name. Reactions matching no class and
+ * reactions belonging to always updated classes are gathered in a single
+ * class of always updated reactions.
  */
 class ManualDispatchSolverFactory : public SolverFactory
 {
@@ -92,8 +123,46 @@ class ManualDispatchSolverFactory : public SolverFactory
   // ===========================
   //
   Solver* create (const SimulationParams& params, CellState& cell_state) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "ManualDispatchSolver"; return output; }
+
+  /**
+   * @brief Check whether a reaction matches one of the patterns of a class.
+   * @param reaction Reaction to check.
+   * @param patterns Reaction types or name patterns ('*' matches any
+   *  sequence of characters).
+   * @return True if reaction matches one of the patterns.
+   */
+  static bool matches (const Reaction& reaction,
+		       const std::vector <std::string>& patterns);
+
+  /**
+   * @brief Check whether a string matches a pattern.
+   * @param text String to check.
+   * @param pattern Pattern where '*' matches any sequence of characters.
+   * @return True if text matches the pattern.
+   */
+  static bool matches (const std::string& text, const std::string& pattern);
 };
 
+/**
+ * @brief Class used to create NextReactionSolver.
+ */
+class NextReactionSolverFactory : public SolverFactory
+{
+ public:
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  Solver* create (const SimulationParams& params, CellState& cell_state) const;
+
+ private:
+  std::ostream& print (std::ostream& output) const
+    { output << "NextReactionSolver"; return output; }
+};
 
 // ======================
 //  Inline declarations
@@ -101,8 +170,11 @@ class ManualDispatchSolverFactory : public SolverFactory
 //
 #include "naivesolver.h"
 #include "manualdispatchsolver.h"
+#include "nextreactionsolver.h"
 #include "cellstate.h"
 #include "reactionclassification.h"
+#include "simulationparams.h"
+#include "reaction.h"
 
 inline Solver*
 NaiveSolverFactory::create (const SimulationParams& params,
@@ -115,10 +187,98 @@ inline Solver*
 ManualDispatchSolverFactory::create (const SimulationParams& params,
 				     CellState& cell_state) const
 {
+  const std::vector <double>& time_steps = params.reaction_class_time_steps();
+  const std::vector < std::vector <std::string> >& 
+    patterns = params.reaction_class_patterns();
+
+  // dispatch reactions among user-defined classes, last class is used for
+  // reactions matching no class
+  const std::vector <Reaction*>& reactions = cell_state.reactions();
+  std::vector < std::vector <Reaction*> > classes (time_steps.size()+1);
+  for (std::size_t i = 0; i < reactions.size(); ++i)
+    {
+      std::size_t class_index = 0;
+      while ((class_index < time_steps.size())
+	     && !matches (*reactions [i], patterns [class_index]))
+	{ ++class_index; }
+      classes [class_index].push_back (reactions [i]);
+    }
+
+  // create (non empty) classes, all always updated reactions end up in the
+  // same class
   ReactionClassification classification;
-  int class_id = classification.create_new_class (0.001);
-  classification.add_reactions_to_class (class_id, cell_state.reactions());
+  int always_updated_id = -1;
+  for (std::size_t i = 0; i < classes.size(); ++i)
+    {
+      if (classes [i].empty()) { continue; }
+      if ((i == time_steps.size())
+	  || (time_steps [i] == ReactionClassification::ALWAYS_UPDATED()))
+	{
+	  if (always_updated_id == -1)
+	    {
+	      always_updated_id = classification.create_new_class
+		(ReactionClassification::ALWAYS_UPDATED());
+	    }
+	  classification.add_reactions_to_class (always_updated_id, 
+						 classes [i]);
+	}
+      else
+	{
+	  int class_id = classification.create_new_class (time_steps [i]);
+	  classification.add_reactions_to_class (class_id, classes [i]);
+	}
+    }
   return new ManualDispatchSolver (params, classification);
 }
 
+inline bool
+ManualDispatchSolverFactory::matches (const Reaction& reaction,
+				      const std::vector <std::string>& patterns)
+{
+  // reaction names are built from the line defining the reaction, possibly
+  // preceded by a description of the sense (e.g. "Sense of ...") so types
+  // can be checked with the first word of the line
+  for (std::size_t i = 0; i < patterns.size(); ++i)
+    {
+      if (patterns [i].find ('*') != std::string::npos)
+	{
+	  if (matches (reaction.name(), patterns [i])) { return true; }
+	}
+      else if (matches (reaction.name(), patterns [i] + " *")
+	       || matches (reaction.name(), "* of " + patterns [i] + " *"))
+	{ return true; }
+    }
+  return false;
+}
+
+inline bool
+ManualDispatchSolverFactory::matches (const std::string& text,
+				      const std::string& pattern)
+{
+  // greedy matching, backtracking to the last '*' encountered on failure
+  std::size_t text_pos = 0, pattern_pos = 0;
+  std::size_t star_pos = std::string::npos, star_text_pos = 0;
+  while (text_pos < text.size())
+    {
+      if ((pattern_pos < pattern.size()) && (pattern [pattern_pos] == '*'))
+	{ star_pos = pattern_pos++; star_text_pos = text_pos; }
+      else if ((pattern_pos < pattern.size())
+	       && (pattern [pattern_pos] == text [text_pos]))
+	{ ++pattern_pos; ++text_pos; }
+      else if (star_pos != std::string::npos)
+	{ pattern_pos = star_pos + 1; text_pos = ++star_text_pos; }
+      else { return false; }
+    }
+  while ((pattern_pos < pattern.size()) && (pattern [pattern_pos] == '*'))
+    { ++pattern_pos; }
+  return (pattern_pos == pattern.size());
+}
+
+inline Solver*
+NextReactionSolverFactory::create (const SimulationParams& params,
+				   CellState& cell_state) const
+{
+  return new NextReactionSolver (params, cell_state.reactions());
+}
+
 #endif // SOLVER_FACTORY_H
@@ -0,0 +1,102 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file sortingratevector.cpp
+ * @brief Implementation of the SortingRateVector class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <iostream> // std::cout
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include <limits> // std::numeric_limits
+
+#include "sortingratevector.h"
+
+// ==========================
+//  Constructors/Destructors
+// ==========================
+//
+SortingRateVector::SortingRateVector (int number_rates)
+  : _rates (number_rates, 0)
+  , _indices (number_rates, 0)
+  , _positions (number_rates, 0)
+  , _total_rate (0)
+  , _current_total_rate (0)
+  , _number_changes (0)
+  , _number_nonzero (0)
+  , _largest_rate (0)
+{
+  /** @pre number_rates must be positive. */
+  REQUIRE (number_rates >= 0);
+  for (int i = 0; i < number_rates; ++i) { _indices [i] = _positions [i] = i; }
+}
+
+// Not needed for this class (use of compiler-generated versions)
+// SortingRateVector::SortingRateVector (const SortingRateVector& other_vector);
+// SortingRateVector& SortingRateVector::operator= (const SortingRateVector& other_vector);
+// SortingRateVector::~SortingRateVector (void);
+
+// ===========================
+//  Public Methods - Commands
+// ===========================
+//
+void SortingRateVector::update_cumulates (void)
+{
+  // incremental updates accumulate rounding errors: resum from time to time
+  // or when the total is not larger than the error it may contain
+  double error_bound = _number_changes * _largest_rate 
+    * std::numeric_limits <double>::epsilon();
+  if (_number_nonzero == 0)
+    {
+      _current_total_rate = 0;
+      _number_changes = 0;
+      _largest_rate = 0;
+    }
+  else if ((_number_changes >= _rates.size())
+	   || (_current_total_rate <= 4*error_bound))
+    { _resum(); }
+  _total_rate = _current_total_rate;
+}
+
+// ============================
+//  Public Methods - Accessors
+// ============================
+//
+
+
+// =================
+//  Private Methods
+// =================
+//
+void SortingRateVector::_resum (void)
+{
+  _current_total_rate = 0;
+  _largest_rate = 0;
+  for (std::size_t i = 0; i < _rates.size(); ++i) 
+    { 
+      _current_total_rate += _rates [i];
+      if (_rates [i] > _largest_rate) { _largest_rate = _rates [i]; }
+    }
+  _number_changes = 0;
+}
@@ -0,0 +1,249 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+
+/**
+ * @file sortingratevector.h
+ * @brief Header for the SortingRateVector class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// Multiple include protection
+//
+#ifndef SORTING_RATE_VECTOR_H
+#define SORTING_RATE_VECTOR_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+#include <algorithm> // std::swap
+
+// ======================
+//  Forward declarations
+// ======================
+//
+#include "forwarddeclarations.h"
+#include "ratecontainer.h"
+
+/**
+ * @brief Class storing rates in a vector sorted by firing frequency.
+ *
+ * SortingRateVector inherits from RateContainer. It implements the sorting
+ * direct method: rates are stored in a vector that is scanned linearly from
+ * the front when drawing, and every time a rate is drawn it is swapped with
+ * its predecessor. Rates that are drawn often therefore bubble to the front
+ * of the vector, and drawing costs O(K) where K is the mean position of
+ * drawn rates, which is small when a few reactions account for most
+ * firings. Total rate is maintained incrementally and resummed
+ * periodically, so that updates cost O(1). It is also resummed when it gets
+ * close to the rounding error accumulated by incremental updates, and it is
+ * exactly zero when all rates are zero.
+ * @sa RateVector.
+ */
+class SortingRateVector : public RateContainer
+{
+ public:
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Constructor.
+   * @param number_rates Number of rates to store.
+   */
+  SortingRateVector (int number_rates);
+
+  // Not needed for this class (use of compiler-generated versions)
+  // (3-0 rule: either define all 3 following or none of them)
+  // /* @brief Copy constructor. */
+  // SortingRateVector (const SortingRateVector& other_vector);
+  // /* @brief Assignment operator. */
+  // SortingRateVector& operator= (const SortingRateVector& other_vector);
+  // /* @brief Destructor. */
+  // ~SortingRateVector (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  // Redefined from RateContainer
+  int random_index (void) const;
+  void update_cumulates (void);
+  void set_rate (int index, double value);
+
+  /**
+   * @brief Find reaction index corresponding to cumulated rate value.
+   * @param value Cumulated rate value.
+   * @return Reaction index such that the cumulated rate of rates stored
+   *  before it (in current order) is smaller than value while the cumulated
+   *  rate including it is greater or equal to value.
+   */
+  int find (double value) const;
+
+  // ============================
+  //  Public Methods - Accessors
+  // ============================
+  //
+  // Redefined from RateContainer
+  double total_rate (void) const;
+
+  /**
+   * @brief Accessor to current position of a rate.
+   * @param index Index of the rate.
+   * @return Position of the rate in the scanning order.
+   */
+  int position (int index) const;
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  // scanning order is modified when drawing, hence mutable attributes
+  /** @brief Rates in scanning order. */
+  mutable std::vector <double> _rates;
+
+  /** @brief Rate index stored at every position. */
+  mutable std::vector <int> _indices;
+
+  /** @brief Position of every rate index. */
+  mutable std::vector <int> _positions;
+
+  /** @brief Total rate as of last update. */
+  double _total_rate;
+
+  /** @brief Total rate including modifications since last update. */
+  double _current_total_rate;
+
+  /** @brief Number of modifications since total rate was last resummed. */
+  int _number_changes;
+
+  /** @brief Number of strictly positive rates. */
+  int _number_nonzero;
+
+  /** @brief Upper bound of rates stored since total rate was last resummed. */
+  double _largest_rate;
+
+  // =================
+  //  Private Methods
+  // =================
+  //
+  // Redefined from RateContainer
+  std::ostream& _print (std::ostream& output) const;
+
+  /**
+   * @brief Compute sum of rates directly.
+   * @return Sum of rates.
+   */
+  double _sum_of_rates (void) const;  
+
+  /**
+   * @brief Recompute total rate and largest rate from scratch.
+   */
+  void _resum (void);
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h"
+
+inline int SortingRateVector::random_index (void) const
+{
+  /** Total rate must be strictly positive. */
+  ENSURE (total_rate() > 0);
+  int index = find (RandomHandler::instance().draw_uniform
+		    (1e-16*total_rate(), total_rate()));
+
+  // bubble drawn rate towards the front
+  int position = _positions [index];
+  if (position > 0)
+    {
+      int previous_index = _indices [position-1];
+      std::swap (_rates [position-1], _rates [position]);
+      _indices [position-1] = index;
+      _indices [position] = previous_index;
+      _positions [index] = position-1;
+      _positions [previous_index] = position;
+    }
+  return index;
+}
+
+inline int SortingRateVector::find (double value) const
+{
+  /** @pre value must be strictly positive. */
+  REQUIRE (value > 0);
+
+  int position = 0;
+  int last = _rates.size() - 1;
+  double cumulate = _rates [0];
+  while ((cumulate < value) && (position < last))
+    { cumulate += _rates [++position]; }
+
+  // rounding may make us reach the end or a zero rate, we take the previous
+  // nonzero rate instead
+  while ((_rates [position] == 0) && (position > 0)) { --position; }
+  /** @post Rate of returned index must be strictly positive. */
+  ENSURE (_rates [position] > 0);
+  return _indices [position];
+}
+
+inline void SortingRateVector::set_rate (int index, double value)
+{
+  /** @pre index must be within vector bounds. */
+  REQUIRE ((index >= 0) && (index < _positions.size()));
+  /** @pre value must be positive. */
+  REQUIRE (value >= 0);
+  double& rate = _rates [_positions [index]];
+  if ((rate == 0) && (value > 0)) { ++_number_nonzero; }
+  else if ((rate > 0) && (value == 0)) { --_number_nonzero; }
+  if (value > _largest_rate) { _largest_rate = value; }
+  _current_total_rate += value - rate;
+  rate = value;
+  ++_number_changes;
+}
+
+inline double SortingRateVector::total_rate (void) const
+{
+  /** @post Total rate should be positive. */
+  ENSURE (_total_rate >= 0);
+  return _total_rate;
+}
+
+inline int SortingRateVector::position (int index) const
+{
+  /** @pre index must be within vector bounds. */
+  REQUIRE ((index >= 0) && (index < _positions.size()));
+  return _positions [index];
+}
+
+inline double SortingRateVector::_sum_of_rates (void) const
+{
+  double total = 0;
+  for (std::size_t i = 0; i < _rates.size(); ++i) { total += _rates [i]; }
+  return total;
+}
+
+inline std::ostream& SortingRateVector::_print (std::ostream& output) const
+{
+  for (std::size_t i = 0; i < _positions.size(); ++i)
+    { output << _rates [_positions [i]] << " "; }
+  output << total_rate();
+  return output;
+}
+
+#endif // SORTING_RATE_VECTOR_H
@@ -0,0 +1,138 @@
+// 
+// Copyright 2017 INRA
+// Authors: M. Dinh, S. Fischer
+// Last modification: 2017-09-19
+// 
+// 
+// Licensed under the GNU General Public License.
+// You should have received a copy of the GNU General Public License
+// along with BiPSim.  If not, see <http://www.gnu.org/licenses/>.
+// 
+
+
+/**
+ * @file specializeddependencyratemanager.h
+ * @brief Header for the SpecializedDependencyRateManager class.
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+// Multiple include protection
+//
+#ifndef SPECIALIZED_DEPENDENCY_RATE_MANAGER_H
+#define SPECIALIZED_DEPENDENCY_RATE_MANAGER_H
+
+// ==================
+//  General Includes
+// ==================
+//
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "forwarddeclarations.h"
+#include "dependencyratemanager.h"
+
+/**
+ * @brief DependencyRateManager compiled for a specific rate container.
+ *
+ * SpecializedDependencyRateManager inherits DependencyRateManager. The type
+ * of rate container is known at compile time, so that rate updates performed
+ * at every step call the container directly (and can be inlined) instead of
+ * going through the RateContainer interface. The container type must match
+ * the container created by the factory of the simulation parameters, which
+ * is checked once at construction.
+ *
+ * This is only a partial devirtualization: drawing the next reaction and
+ * reading the total rate still go through the RateManager and RateContainer
+ * interfaces (a constant number of calls per step). The gain is therefore
+ * limited to systems where many rates are updated per step and the container
+ * update is cheap (vector and hybrid containers); trees see no measurable
+ * change.
+ * @tparam Container Type of rate container created by the factory.
+ */
+template <class Container>
+class SpecializedDependencyRateManager : public DependencyRateManager
+{
+ public:
+
+  // ==========================
+  //  Constructors/Destructors
+  // ==========================
+  //
+  /**
+   * @brief Default constructor.
+   * @param params Simulation parameters.
+   * @param reactions Vector of reactions whose rates need to be stored and
+   *  updated.
+   */
+  SpecializedDependencyRateManager (const SimulationParams& params,
+				    const std::vector <Reaction*>& reactions);
+
+ private:
+  // Forbidden
+  /** @brief Copy constructor. */
+  SpecializedDependencyRateManager
+    (const SpecializedDependencyRateManager& other);
+  /** @brief Assignment operator. */
+  SpecializedDependencyRateManager&
+    operator= (const SpecializedDependencyRateManager& other);
+ public:
+  // Not needed for this class (use of compiler-generated versions)
+  // /* @brief Destructor. */
+  // ~SpecializedDependencyRateManager (void);
+
+  // ===========================
+  //  Public Methods - Commands
+  // ===========================
+  //
+  // redefined from DependencyRateManager
+  void update_rates (void);
+
+private:
+  // ============
+  //  Attributes
+  // ============
+  //
+  /** @brief Rate container with its concrete type. */
+  Container& _container;
+};
+
+// ======================
+//  Inline declarations
+// ======================
+//
+#include "macros.h" // REQUIRE()
+#include "reaction.h"
+#include "ratevalidity.h"
+
+template <class Container>
+inline SpecializedDependencyRateManager <Container>::
+SpecializedDependencyRateManager (const SimulationParams& params,
+				  const std::vector <Reaction*>& reactions)
+  : DependencyRateManager (params, reactions)
+  , _container (static_cast <Container&> (rate_container()))
+{
+  /** @pre Container must have been created with the expected type. */
+  REQUIRE (dynamic_cast <Container*> (&rate_container()) != 0);
+}
+
+template <class Container>
+inline void SpecializedDependencyRateManager <Container>::update_rates (void)
+{
+  // qualified calls are resolved at compile time
+  const std::vector <Reaction*>& all_reactions = reactions();
+  RateValidity& validity = rate_validity();
+  const std::vector <int>& invalid_rates = validity.invalid_rates();
+  for (std::size_t i = 0; i < invalid_rates.size(); ++i)
+    {
+      Reaction* reaction = all_reactions [invalid_rates [i]];
+      reaction->update_rate();
+      _container.Container::set_rate (invalid_rates [i], reaction->rate());
+    }
+  validity.clear();
+  _container.Container::update_cumulates();
+}
+
+#endif // SPECIALIZED_DEPENDENCY_RATE_MANAGER_H
@@ -40,7 +40,7 @@
 //  Constructors/Destructors
 // ==========================
 //
-TemplateFilter::TemplateFilter (const LoadingTable& table)
+TemplateFilter::TemplateFilter (LoadingTable& table)
   : _table (table)
   , _loading_rates (table.size())
   , _rate_validity (table.size())
@@ -65,9 +65,10 @@ TemplateFilter::TemplateFilter (const LoadingTable& table)
 //
 void TemplateFilter::add (BoundUnit& unit)
 {
-  int template_index =  _table.template_index 
-    (unit.location().sequence().substr 
-     (unit.reading_frame(), _table.template_length()));
+  // template codes of the sequence are computed the first time it is met
+  _table.index_sequence (unit.location());
+  int template_index = _table.template_index 
+    (unit.location(), unit.reading_frame());
 
   if (template_index != LoadingTable::UNKNOWN_TEMPLATE) 
     {
@@ -87,9 +88,8 @@ void TemplateFilter::add (BoundUnit& unit)
 
 void TemplateFilter::remove (BoundUnit& unit)
 {
-  int template_index =  _table.template_index 
-    (unit.location().sequence().substr 
-     (unit.reading_frame(), _table.template_length()));
+  int template_index = _table.template_index 
+    (unit.location(), unit.reading_frame());
 
   // if unit was reading an identifed template
   if (template_index != LoadingTable::UNKNOWN_TEMPLATE) 
@@ -63,7 +63,7 @@ class TemplateFilter : public BoundUnitFilter
    * @param table LoadingTable containing templates according to which units
    *  should be segregated as well as loading rates.
    */
-  TemplateFilter (const LoadingTable& table);
+  TemplateFilter (LoadingTable& table);
 
   // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
@@ -113,7 +113,7 @@ private:
   // ============
   //
   /** @brief The table of template-chemical associations. */
-  const LoadingTable& _table;
+  LoadingTable& _table;
 
   /** @brief Unit lists indexed by template they are reading. */
   std::vector <BoundUnitList> _unit_map;
@@ -26,6 +26,8 @@
 //  Project Includes
 // ==================
 //
+#include <limits> // std::numeric_limits
+
 #include "macros.h" // REQUIRE
 #include "config.h" // DISPLAY_WARNINGS
 
@@ -33,26 +35,38 @@
 #include "boundchemical.h"
 #include "boundunit.h"
 #include "chemicalsequence.h"
+#include "boundunitindex.h"
+#include "randomhandler.h"
 
 // ==========================
 //  Constructors/Destructors
 // ==========================
 //
+const double Translocation::NO_LEAP_LEFT = 
+  std::numeric_limits<double>::infinity();
+
 Translocation::Translocation (BoundChemical& processive_chemical,
 			      BoundChemical& chemical_after_step,
 			      BoundChemical& stalled_form,
-			      int step_size, double rate)
-  : _processive_chemical (processive_chemical)
+			      int step_size, double rate, int leap_length)
+  : Reaction (TRANSLOCATION)
+  , _processive_chemical (processive_chemical)
   , _chemical_after_step (chemical_after_step)
   , _stalled_form (stalled_form)
   , _step_size (step_size)
   , _rate (rate)
   , _volume_constant (rate)
+  , _leap_length (leap_length)
 {
   /** @pre Rate must be positive. */
   REQUIRE (rate >= 0);
   /** @pre Step size must be strictly positive. */
   REQUIRE (step_size > 0);
+  /** @pre Leap length must be strictly positive. */
+  REQUIRE (leap_length > 0);
+  /** @pre Only translocations back to the processive form can leap. */
+  REQUIRE ((leap_length == 1) 
+	   || (&chemical_after_step == &processive_chemical));
 
   _reactants.push_back (&processive_chemical);
   _products.push_back (&chemical_after_step);
@@ -68,6 +82,26 @@ Translocation::Translocation (BoundChemical& processive_chemical,
 //  Public Methods - Commands
 // ===========================
 //
+void Translocation::schedule_leaps (double time)
+{
+  for (std::size_t i = 0; i < _new_leaps.size(); ++i)
+    {
+      _leaps.insert (std::make_pair (time + _new_leaps [i].first,
+				     _new_leaps [i].second));
+    }
+  _new_leaps.clear();
+}
+
+void Translocation::complete_leap (void)
+{
+  /** @pre A leap must be in progress. */
+  REQUIRE (!_leaps.empty());
+
+  BoundUnit& unit = *(_leaps.begin()->second);
+  _leaps.erase (_leaps.begin());
+  unit.location().move_unit (unit, _leap_length * _step_size);
+  _chemical_after_step.add (unit);
+}
 
 // ============================
 //  Public Methods - Accessors
@@ -87,15 +121,23 @@ void Translocation::do_reaction (void)
   
   // choose one unit to move randomly
   BoundUnit& unit = _processive_chemical.random_unit();
+
+  // the first step has just been drawn, the others follow as a single leap
+  if ((_leap_length > 1) && can_leap (unit))
+    {
+      _processive_chemical.remove (unit);
+      _new_leaps.push_back 
+	(std::make_pair (RandomHandler::instance().draw_erlang 
+			 (_leap_length - 1, _rate), &unit));
+      return;
+    }
   
   // update position on location if it is possible
   int new_first = unit.first() + _step_size;
   int new_last = unit.last() + _step_size;
   if (!unit.location().is_out_of_bounds (new_first, new_last))
     {
-      unit.location().unbind_unit (unit.first(), unit.last()); 
-      unit.move (_step_size);
-      unit.location().bind_unit (unit.first(), unit.last());
+      unit.location().move_unit (unit, _step_size);
     }
   else 
     { 
@@ -125,3 +167,23 @@ void Translocation::print (std::ostream& output) const
 {
   output << "Translocation reaction.";
 }
+
+bool Translocation::can_leap (const BoundUnit& unit) const
+{
+  const ChemicalSequence& location = unit.location();
+  int distance = _leap_length * _step_size;
+  int first_frame = unit.reading_frame() + _step_size;
+  int last_frame = unit.reading_frame() + distance - _step_size;
+  if (location.is_out_of_bounds (unit.first(), unit.last() + distance)
+      || location.is_out_of_bounds (first_frame, last_frame))
+    { return false; }
+
+  // sites under the unit or in its way would be freed or covered too late,
+  // switches along the way would be skipped (the final one is applied when
+  // the unit is added back)
+  return (!location.bound_units().collides (unit.last() + 1, 
+					    unit.last() + distance)
+	  && !location.has_binding_site (unit.first(), 
+					 unit.last() + distance)
+	  && !location.has_switch_site (first_frame, last_frame));
+}
@@ -26,6 +26,9 @@
 //  General Includes
 // ==================
 //
+#include <map> // std::multimap
+#include <vector> // std::vector
+#include <utility> // std::pair
 
 
 // ==================
@@ -41,6 +44,18 @@
  * The polymerase is supposed to process along a sequence and to generate a
  * a product for which the sequence is a template. Translocation corresponds to
  * the movement along the sequence and synthesis of the product.
+ *
+ * Translocations whose form after step is the translocating form itself can
+ * leap: when a unit is drawn and its next L steps are free of other units,
+ * binding sites and switch sites (and within the sequence), it is withdrawn
+ * from the translocating form and moved L steps at once after an
+ * Erlang(L-1, rate) delay, so that the L steps take Erlang(L, rate) time as
+ * they would one by one. Otherwise a single step is performed. This is an
+ * approximation: while leaping, the unit keeps its initial footprint and is
+ * not part of any chemical (it cannot react and is not counted in outputs),
+ * and a leap is counted as one translocation. Leaps must be dated with
+ * schedule_leaps() after the reaction is performed and completed with
+ * complete_leap() when their time comes.
  */
 class Translocation : public Reaction
 {
@@ -57,11 +72,14 @@ class Translocation : public Reaction
    *  chemical encounters end of sequence.
    * @param step_size Number of bases processed at each translocation step.
    * @param rate Translocation rate (in step/s).
+   * @param leap_length Maximal number of steps performed at once (1 for
+   *  single steps, larger values require chemical_after_step to be the
+   *  processive chemical).
    */
   Translocation (BoundChemical& processive_chemical,
 		 BoundChemical& chemical_after_step,
 		 BoundChemical& stalled_form,
-		 int step_size, double rate);
+		 int step_size, double rate, int leap_length = 1);
 
   // Not needed for this class (use of compiler-generated versions)
   // (3-0 rule: either define all 3 following or none of them)
@@ -78,6 +96,17 @@ class Translocation : public Reaction
   //
   // Redefined from reaction
   void handle_volume_change (double volume);
+
+  /**
+   * @brief Date leaps started since last call.
+   * @param time Time at which the leaps started (time of last reaction).
+   */
+  void schedule_leaps (double time);
+
+  /**
+   * @brief Move the unit whose leap ends first to its final position.
+   */
+  void complete_leap (void);
   
 
   // ============================
@@ -87,16 +116,47 @@ class Translocation : public Reaction
   // Redefined from Reaction
   bool is_reaction_possible (void) const;
 
+  /**
+   * @brief Accessor to maximal number of steps performed at once.
+   * @return Maximal number of steps performed at once (1 if no leaping).
+   */
+  int leap_length (void) const;
+
+  /**
+   * @brief Accessor to end time of the first leap.
+   * @return Time at which the first leap ends, NO_LEAP_LEFT if no leap is
+   *  in progress.
+   */
+  double next_leap_time (void) const;
+
+  // ==================
+  //  Public Constants
+  // ==================
+  //
+  /** @brief Shortcut for double value representing infinity. */
+  static const double NO_LEAP_LEFT;
+
  private:
   // =================
   //  Private Methods
   // =================
   //
+  /** @brief Reaction dispatches calls directly on its concrete type. */
+  friend class Reaction;
+
   // Redefined from Reaction
   void do_reaction (void);
   double compute_rate (void) const;
   void print (std::ostream& output) const;
 
+  /**
+   * @brief Check whether a unit can leap.
+   * @param unit Unit about to translocate.
+   * @return True if the next leap_length steps of the unit stay within the
+   *  sequence and meet no other unit, binding site or switch site.
+   */
+  bool can_leap (const BoundUnit& unit) const;
+
   // ============
   //  Attributes
   // ============
@@ -114,6 +174,13 @@ class Translocation : public Reaction
   double _rate;
   /** @brief Volume constant. */
   double _volume_constant;
+  /** @brief Maximal number of steps performed at once. */
+  int _leap_length;
+
+  /** @brief Units that started leaping, with duration of their leap. */
+  std::vector <std::pair <double, BoundUnit*> > _new_leaps;
+  /** @brief Leaping units, ordered by end time of their leap. */
+  std::multimap <double, BoundUnit*> _leaps;
 };
 
 // ======================
@@ -132,4 +199,15 @@ inline void Translocation::handle_volume_change (double volume)
   // no volume dependency: _volume_constant = _rate;
 }
 
+inline int Translocation::leap_length (void) const
+{
+  return _leap_length;
+}
+
+inline double Translocation::next_leap_time (void) const
+{
+  if (_leaps.empty()) { return NO_LEAP_LEFT; }
+  return _leaps.begin()->first;
+}
+
 #endif // TRANSLOCATION_H
@@ -83,6 +83,11 @@ class UpdatedRateGroup : public ReactionGroup
   void schedule_next_reaction (double current_time);
   void reinitialize (double time);
 
+  /**
+   * @brief Let rate container reorganize itself for faster drawing.
+   */
+  void reshape_rates (void);
+
   // ============================
   //  Public Methods - Accessors
   // ============================
@@ -132,5 +137,10 @@ inline Reaction* UpdatedRateGroup::next_reaction (void) const
   return _next_reaction;
 }
 
+inline void UpdatedRateGroup::reshape_rates (void)
+{
+  _rate_manager.reshape_rates();
+}
+
 
 #endif // UPDATED_RATE_GROUP_H
@@ -0,0 +1,100 @@
+/**
+ * @file aliastable_test.cpp
+ * @brief Unit testing for AliasTable class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE AliasTable
+#include <boost/test/unit_test.hpp>
+
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "aliastable.h"
+#include "experimentalcumulative.h"
+
+
+class TableSize5
+{
+public:
+  TableSize5 (void)
+    : zero_table (5)
+  {}
+
+  AliasTable zero_table;
+};
+
+BOOST_FIXTURE_TEST_SUITE (BaseTests, TableSize5)
+ 
+BOOST_AUTO_TEST_CASE (total_rate_zeroTable_returnsZero)
+{
+  BOOST_CHECK_SMALL (zero_table.total_rate(), 1e-15);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_oneNonZeroRate_returnsRate)
+{
+  zero_table.set_rate (0, 2); zero_table.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_table.total_rate(), 2, 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE (find_oneNonZeroRate_returnsIndexNonZeroRate)
+{
+  zero_table.set_rate (3, 2); zero_table.update_cumulates();
+  for (int i = 0; i < 10; ++i)
+    { BOOST_CHECK_EQUAL (zero_table.find (0.5*i), 3); }
+}
+
+BOOST_AUTO_TEST_CASE (find_equalRates_returnsBin)
+{
+  for (int i = 0; i < 5; ++i) { zero_table.set_rate (i, 1); }
+  zero_table.update_cumulates();
+  for (int i = 0; i < 5; ++i)
+    { BOOST_CHECK_EQUAL (zero_table.find (i + 0.5), i); }
+}
+
+BOOST_AUTO_TEST_CASE (assign_newRates_resizesAndUpdatesTotal)
+{
+  std::vector <double> rates (3, 0);
+  rates [1] = 4;
+  zero_table.assign (rates);
+  BOOST_CHECK_EQUAL (zero_table.size(), 3);
+  BOOST_CHECK_CLOSE (zero_table.total_rate(), 4, 1e-13);
+  BOOST_CHECK_EQUAL (zero_table.random_index(), 1);
+}
+
+double cumulative (int index)
+{
+  // cum: r0 : 2, r1 : 5, r2 : 8, r4 : 14
+  switch (index)
+    {
+    case 0: return 2.0/14;
+    case 1: return 5.0/14;
+    case 2: return 8.0/14;
+    case 3: return 8.0/14;
+    case 4: return 1;
+    }
+  return -1;
+}
+
+BOOST_AUTO_TEST_CASE (random_index_tenThousandDraws_statisticsAreCorrect)
+{
+  zero_table.set_rate (0, 2); zero_table.set_rate (1, 3);
+  zero_table.set_rate (2, 3); zero_table.set_rate (4, 6);
+  zero_table.update_cumulates();
+  ExperimentalCumulative <int> ecf;
+  for (int i = 0; i < 10000; ++i) { ecf.add_pick (zero_table.random_index()); }
+  BOOST_CHECK_EQUAL (ecf(2), ecf(3));
+  BOOST_CHECK_SMALL (distance_to_discrete_cumulative (ecf, cumulative), 0.02);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
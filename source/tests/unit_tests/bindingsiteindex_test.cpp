@@ -0,0 +1,135 @@
+/**
+ * @file bindingsiteindex_test.cpp
+ * @brief Unit testing for BindingSiteIndex class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE BindingSiteIndex
+#include <boost/test/unit_test.hpp>
+
+#include <iostream>
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "bindingsiteindex.h"
+#include "bindingsite.h"
+#include "chemicalsequence.h"
+#include "sitedispenser.h"
+
+class BindingSiteIndexL100
+{
+public:
+  BindingSiteIndexL100 (void) 
+    : site_dispenser (100)
+  {}  
+  
+public:
+  BindingSiteIndex empty_index;
+  SiteDispenser site_dispenser;
+};
+
+BOOST_FIXTURE_TEST_SUITE (BaseTests, BindingSiteIndexL100)
+ 
+BOOST_AUTO_TEST_CASE (size_emptyIndex_returnsZero)
+{
+  BOOST_CHECK_EQUAL (empty_index.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE (size_indexWithTwoSites_returnsTwo)
+{
+  empty_index.add_site (site_dispenser.new_site (10, 20));
+  empty_index.add_site (site_dispenser.new_site (20, 30));
+  BOOST_CHECK_EQUAL (empty_index.size(), 2);
+}
+ 
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE (UpdateTests, BindingSiteIndexL100)
+
+BOOST_AUTO_TEST_CASE (update_oneSiteUpdateOnSite_isUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  empty_index.add_site (bs); empty_index.update (10,20);
+  BOOST_CHECK_EQUAL (bs.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_oneSiteUpdateCrossingSite_isUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  empty_index.add_site (bs); empty_index.update (15,25); 
+  BOOST_CHECK_EQUAL (bs.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_oneSiteUpdateCrossingSite_isUpdated2)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  empty_index.add_site (bs); empty_index.update (0,30); 
+  BOOST_CHECK_EQUAL (bs.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_oneSiteUpdateNonOverlapping_isNotUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  empty_index.add_site (bs); empty_index.update (0,9); 
+  BOOST_CHECK_EQUAL (bs.was_updated(), false);
+  empty_index.update (30,40); BOOST_CHECK_EQUAL (bs.was_updated(), false);
+}
+
+BOOST_AUTO_TEST_CASE (update_twoSitesUpdateOverlapsSiteTwo_siteTwoUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  MockBindingSite& bs2 = site_dispenser.new_site (30,40);
+  empty_index.add_site (bs); empty_index.add_site (bs2);  
+  empty_index.update (35, 45); 
+  BOOST_CHECK_EQUAL (bs.was_updated(), false);
+  BOOST_CHECK_EQUAL (bs2.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_twoSitesUpdateOverlapsBothSites_bothSitesUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  MockBindingSite& bs2 = site_dispenser.new_site (30,40);
+  empty_index.add_site (bs); empty_index.add_site (bs2);  
+  empty_index.update (15, 35); 
+  BOOST_CHECK_EQUAL (bs.was_updated(), true);
+  BOOST_CHECK_EQUAL (bs2.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_siteAddedAfterUpdate_isUpdated)
+{
+  MockBindingSite& bs = site_dispenser.new_site (10,20);
+  empty_index.add_site (bs); empty_index.update (0, 5);
+  MockBindingSite& bs2 = site_dispenser.new_site (0,5);
+  empty_index.add_site (bs2); empty_index.update (0, 5);
+  BOOST_CHECK_EQUAL (bs.was_updated(), false);
+  BOOST_CHECK_EQUAL (bs2.was_updated(), true);
+}
+
+BOOST_AUTO_TEST_CASE (update_denseOverlappingSites_exactlyOverlappingUpdated)
+{
+  // one site per position spanning 10 bases, added in reverse order
+  std::vector <MockBindingSite*> sites;
+  for (int i = 89; i >= 0; --i)
+    {
+      sites.push_back (&site_dispenser.new_site (i, i+9));
+      empty_index.add_site (*sites.back());
+    }
+  empty_index.update (40, 42);
+  for (std::size_t i = 0; i < sites.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL (sites [i]->was_updated(), 
+			 sites [i]->overlaps (40, 42));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+
+
+/**
+ * @file boundunitindex_test.cpp
+ * @brief Unit testing for BoundUnitIndex class.
+ *
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE BoundUnitIndex
+#include <boost/test/unit_test.hpp>
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "chemicalsequence.h"
+#include "boundunit.h"
+#include "boundunitindex.h"
+
+class Lattice
+{
+public:
+  Lattice (void)
+    : sequence (std::string (100, 'a'))
+    , upstream (sequence, 10, 19, 10)
+    , middle (sequence, 40, 49, 40)
+    , downstream (sequence, 70, 79, 70)
+  {
+    index.add (upstream);
+    index.add (middle);
+    index.add (downstream);
+  }
+
+  ChemicalSequence sequence;
+  BoundUnit upstream, middle, downstream;
+  BoundUnitIndex index;
+};
+
+BOOST_FIXTURE_TEST_SUITE (Queries, Lattice)
+
+BOOST_AUTO_TEST_CASE (size_threeUnitsAdded_returnsThree)
+{
+  BOOST_CHECK_EQUAL (index.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE (next_unit_betweenUnits_returnsDownstreamNeighbour)
+{
+  BOOST_CHECK_EQUAL (index.next_unit (10), &middle);
+  BOOST_CHECK_EQUAL (index.next_unit (50), &downstream);
+  BOOST_CHECK (index.next_unit (70) == 0);
+}
+
+BOOST_AUTO_TEST_CASE (previous_unit_betweenUnits_returnsUpstreamNeighbour)
+{
+  BOOST_CHECK_EQUAL (index.previous_unit (70), &middle);
+  BOOST_CHECK_EQUAL (index.previous_unit (99), &downstream);
+  BOOST_CHECK (index.previous_unit (10) == 0);
+}
+
+BOOST_AUTO_TEST_CASE (gap_downstream_returnsFreePositionsBeforeNextUnit)
+{
+  BOOST_CHECK_EQUAL (index.gap_downstream (19), 20);
+  BOOST_CHECK_EQUAL (index.gap_downstream (39), 0);
+  bool no_unit = (index.gap_downstream (80) == BoundUnitIndex::NO_UNIT);
+  BOOST_CHECK (no_unit);
+}
+
+BOOST_AUTO_TEST_CASE (collides_segmentOverlappingUnit_returnsTrue)
+{
+  BOOST_CHECK (index.collides (0, 10));
+  BOOST_CHECK (index.collides (49, 60));
+  BOOST_CHECK (index.collides (45, 46));
+}
+
+BOOST_AUTO_TEST_CASE (collides_segmentInGap_returnsFalse)
+{
+  BOOST_CHECK (!index.collides (0, 9));
+  BOOST_CHECK (!index.collides (20, 39));
+  BOOST_CHECK (!index.collides (80, 99));
+}
+
+BOOST_AUTO_TEST_CASE (remove_unitRemoved_neighbourQueriesSkipIt)
+{
+  index.remove (middle);
+  BOOST_CHECK_EQUAL (index.size(), 2);
+  BOOST_CHECK_EQUAL (index.next_unit (10), &downstream);
+  BOOST_CHECK (!index.collides (40, 49));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE (SequenceUpdates)
+
+BOOST_AUTO_TEST_CASE (bind_unit_unitBound_appearsInIndex)
+{
+  ChemicalSequence sequence (std::string (100, 'a'));
+  BoundUnit unit (sequence, 5, 14, 5);
+  sequence.bind_unit (unit);
+  BOOST_CHECK_EQUAL (sequence.bound_units().size(), 1);
+  BOOST_CHECK (sequence.bound_units().collides (14, 20));
+  sequence.unbind_unit (unit);
+  BOOST_CHECK_EQUAL (sequence.bound_units().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE (move_unit_unitMoved_indexFollowsUnit)
+{
+  ChemicalSequence sequence (std::string (100, 'a'));
+  BoundUnit unit (sequence, 5, 14, 5);
+  sequence.bind_unit (unit);
+  sequence.move_unit (unit, 3);
+  BOOST_CHECK_EQUAL (unit.first(), 8);
+  BOOST_CHECK (!sequence.bound_units().collides (5, 7));
+  BOOST_CHECK (sequence.bound_units().collides (15, 17));
+  BOOST_CHECK_EQUAL (sequence.bound_units().previous_unit (9), &unit);
+}
+
+BOOST_AUTO_TEST_CASE (move_unit_unitOvertakesNeighbour_orderUpdated)
+{
+  ChemicalSequence sequence (std::string (100, 'a'));
+  BoundUnit behind (sequence, 5, 9, 5);
+  BoundUnit ahead (sequence, 20, 24, 20);
+  sequence.bind_unit (behind);
+  sequence.bind_unit (ahead);
+  BOOST_CHECK_EQUAL (sequence.bound_units().next_unit (0), &behind);
+  sequence.move_unit (behind, 25);
+  BOOST_CHECK_EQUAL (sequence.bound_units().next_unit (0), &ahead);
+  BOOST_CHECK_EQUAL (sequence.bound_units().next_unit (20), &behind);
+  BOOST_CHECK (sequence.bound_units().next_unit (30) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
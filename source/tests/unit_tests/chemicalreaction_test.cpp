@@ -19,6 +19,8 @@
 // ==================
 //
 #include "chemicalreaction.h"
+#include "forwardreaction.h"
+#include "backwardreaction.h"
 #include "freechemical.h"
 #include "boundchemical.h"
 
@@ -88,3 +90,46 @@ BOOST_AUTO_TEST_CASE (constructor_backwardOnlyBoundProductNoBoundReactant_works)
  
 BOOST_AUTO_TEST_SUITE_END()
 
+
+BOOST_FIXTURE_TEST_SUITE (RateTests, CRBuilderFixture)
+
+BOOST_AUTO_TEST_CASE (forward_rate_variousOrders_returnsMassActionRate)
+{
+  FreeChemical A, B, C;
+  A.add (5); B.add (4); C.add (3);
+  add_reactant (&A, -2, 2); add_reactant (&B, -1, 3);
+  add_reactant (&C, -1, 1);
+  ChemicalReaction cr (chemicals, stoichiometries, orders, 0.5, 0);
+  BOOST_CHECK_CLOSE (cr.forward_rate(), 0.5 * 20 * 24 * 3, 1e-13);
+  BOOST_CHECK_EQUAL (cr.backward_rate(), 0);
+}
+
+BOOST_AUTO_TEST_CASE (forward_rate_notEnoughReactants_returnsZero)
+{
+  FreeChemical A, B;
+  A.add (1); B.add (4);
+  add_reactant (&A, -2, 1); add_reactant (&B, -1, 1);
+  ChemicalReaction cr (chemicals, stoichiometries, orders, 1, 0);
+  BOOST_CHECK_EQUAL (cr.forward_rate(), 0);
+}
+
+BOOST_AUTO_TEST_CASE (update_rate_adapters_dispatchOnChemicalReaction)
+{
+  FreeChemical A, B;
+  A.add (5); B.add (3);
+  add_reactant (&A, -1, 1); add_reactant (&B, 1, 1);
+  ChemicalReaction cr (chemicals, stoichiometries, orders, 2, 0.5);
+  ForwardReaction forward (cr);
+  BackwardReaction backward (cr);
+  BOOST_CHECK_EQUAL (forward.type(), Reaction::FORWARD_CHEMICAL);
+  BOOST_CHECK_EQUAL (backward.type(), Reaction::BACKWARD_CHEMICAL);
+  forward.update_rate(); backward.update_rate();
+  BOOST_CHECK_EQUAL (forward.rate(), cr.forward_rate());
+  BOOST_CHECK_EQUAL (backward.rate(), cr.backward_rate());
+  forward.perform();
+  BOOST_CHECK_EQUAL (A.number(), 4);
+  BOOST_CHECK_EQUAL (B.number(), 4);
+  BOOST_CHECK_EQUAL (forward.number_performed(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,8 +6,11 @@ PROGRAMS=("biasedwheel_test" "inputdata_test" "randomhandler_test" \
     "transformationtable_test" "producttable_test" "cellstate_test" \
     "compositiontable_test" "ratetree_test" "vectorlist_test" \
     "rategroup_test" "hybridratecontainer_test" "partialstrand_test" \
-    "sitegroup_test" "sequenceoccupation_test" "freechemical_test" \
-    "boundchemical_test" "chemicalreaction_test")
+    "bindingsiteindex_test" "sequenceoccupation_test" "freechemical_test" \
+    "boundchemical_test" "chemicalreaction_test" "indexedpriorityqueue_test" \
+    "aliastable_test" "karyratetree_test" "sortingratevector_test" \
+    "loadingtable_test" "boundunitindex_test" \
+    "rangemaxtree_test" "siteblock_test")
 ###############################################################################
 
 printf "\n" >> $FILE
@@ -16,6 +16,7 @@
 #include <boost/test/floating_point_comparison.hpp>
 
 #include <iostream> // std::cerr
+#include <cmath> // pow
 
 // ==================
 //  Project Includes
@@ -60,4 +61,34 @@ BOOST_AUTO_TEST_CASE (random_index_linearlyIncreasingRates_drawingStatisticsAreC
  
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_CASE (update_cumulates_automaticBaseRate_firstGroupCostIsBounded)
+{
+  // rates spanning 12 orders of magnitude
+  HybridRateContainer container (100, 0);
+  for (int i = 0; i < 100; ++i)
+    { container.set_rate (i, pow (10.0, i/8 - 9)); }
+  container.update_cumulates();
+  BOOST_CHECK (container.base_rate() > 0);
+  BOOST_CHECK (container.first_group_cost() <= 0.5);
+
+  ExperimentalCumulative <int> ecf;
+  for (int i = 0; i < 10000; ++i) { ecf.add_pick (container.random_index()); }
+  BOOST_CHECK_SMALL (ecf (87), 0.05);
+}
+
+BOOST_AUTO_TEST_CASE (update_cumulates_automaticBaseRate_followsRateDrift)
+{
+  HybridRateContainer container (100, 0);
+  for (int i = 0; i < 100; ++i) { container.set_rate (i, 1+i); }
+  container.update_cumulates();
+  double initial_base_rate = container.base_rate();
+
+  // all rates become much smaller than initial base rate
+  for (int i = 0; i < 100; ++i) { container.set_rate (i, 1e-6*(1+i)); }
+  container.update_cumulates();
+  BOOST_CHECK (container.base_rate() < 1e-3 * initial_base_rate);
+  BOOST_CHECK (container.first_group_cost() <= 0.5);
+  BOOST_CHECK_CLOSE (container.total_rate(), 1e-6*100*101/2, 1e-10);
+}
+
 
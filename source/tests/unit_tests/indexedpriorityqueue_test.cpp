@@ -0,0 +1,89 @@
+/**
+ * @file indexedpriorityqueue_test.cpp
+ * @brief Unit testing for IndexedPriorityQueue class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE IndexedPriorityQueue
+#include <boost/test/unit_test.hpp>
+
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "indexedpriorityqueue.h"
+
+
+class QueueSize10
+{
+public:
+  QueueSize10 (void)
+    : queue (10, 100)
+  {}
+
+  IndexedPriorityQueue <double> queue;
+};
+
+BOOST_FIXTURE_TEST_SUITE (BaseTests, QueueSize10)
+ 
+BOOST_AUTO_TEST_CASE (size_constructedQueue_returnsConstructorSize)
+{
+  BOOST_CHECK_EQUAL (queue.size(), 10);
+  BOOST_CHECK_EQUAL (queue [3], 100);
+}
+
+BOOST_AUTO_TEST_CASE (top_index_decreasedValue_returnsIndexOfValue)
+{
+  queue.update (7, 5);
+  BOOST_CHECK_EQUAL (queue.top_index(), 7);
+  BOOST_CHECK_EQUAL (queue.top_value(), 5);
+  queue.update (2, 1);
+  BOOST_CHECK_EQUAL (queue.top_index(), 2);
+}
+
+BOOST_AUTO_TEST_CASE (top_index_increasedTopValue_returnsNextSmallest)
+{
+  queue.update (4, 1); queue.update (8, 2); queue.update (1, 3);
+  queue.update (4, 50);
+  BOOST_CHECK_EQUAL (queue.top_index(), 8);
+  queue.update (8, 200);
+  BOOST_CHECK_EQUAL (queue.top_index(), 1);
+  BOOST_CHECK_EQUAL (queue [8], 200);
+}
+
+BOOST_AUTO_TEST_CASE (assign_multipleValues_popsValuesInOrder)
+{
+  double values[] = { 9, 3, 7, 0.5, 8, 2, 6, 4, 1, 5 };
+  queue.assign (std::vector <double> (values, values + 10));
+  double previous = -1;
+  for (int i = 0; i < queue.size(); ++i)
+    {
+      int index = queue.top_index();
+      BOOST_CHECK_EQUAL (queue [index], values [index]);
+      BOOST_CHECK (queue.top_value() >= previous);
+      previous = queue.top_value();
+      queue.update (index, 1000);
+    }
+}
+
+BOOST_AUTO_TEST_CASE (push_smallestValue_becomesTop)
+{
+  int index = queue.push (-1);
+  BOOST_CHECK_EQUAL (index, 10);
+  BOOST_CHECK_EQUAL (queue.size(), 11);
+  BOOST_CHECK_EQUAL (queue.top_index(), 10);
+  index = queue.push (500);
+  BOOST_CHECK_EQUAL (queue.top_index(), 10);
+  BOOST_CHECK_EQUAL (queue [index], 500);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
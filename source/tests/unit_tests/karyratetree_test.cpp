@@ -0,0 +1,125 @@
+/**
+ * @file karyratetree_test.cpp
+ * @brief Unit testing for KaryRateTree class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE KaryRateTree
+#include <boost/test/unit_test.hpp>
+
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "karyratetree.h"
+#include "experimentalcumulative.h"
+
+
+class TreeSize10
+{
+public:
+  TreeSize10 (void)
+    : zero_tree (10)
+  {}
+
+  KaryRateTree zero_tree;
+};
+
+BOOST_FIXTURE_TEST_SUITE (BaseTests, TreeSize10)
+ 
+BOOST_AUTO_TEST_CASE (total_rate_zeroTree_returnsZero)
+{
+  BOOST_CHECK_SMALL (zero_tree.total_rate(), 1e-15);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_oneNonZeroRate_returnsRate)
+{
+  zero_tree.set_rate (0, 2); zero_tree.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_tree.total_rate(), 2, 1e-15);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_rateModifiedTwice_returnsLastRate)
+{
+  zero_tree.set_rate (9, 2); zero_tree.update_cumulates();
+  zero_tree.set_rate (9, 5); zero_tree.set_rate (0, 1);
+  zero_tree.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_tree.total_rate(), 6, 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE (find_oneNonZeroRate_returnsIndexNonZeroRate)
+{
+  zero_tree.set_rate (5, 2); zero_tree.update_cumulates();
+  BOOST_CHECK_EQUAL (zero_tree.find (1), 5);
+  BOOST_CHECK_EQUAL (zero_tree.find (2), 5);
+}
+
+BOOST_AUTO_TEST_CASE (find_MultipleRates_returnsAppropriateIndex)
+{
+  zero_tree.set_rate (0, 2); zero_tree.set_rate (1, 3);
+  zero_tree.set_rate (2, 3); zero_tree.set_rate (4, 6);
+  zero_tree.set_rate (9, 1);
+  zero_tree.update_cumulates();
+  BOOST_CHECK_EQUAL (zero_tree.find (1), 0);
+  BOOST_CHECK_EQUAL (zero_tree.find (2), 0);
+  BOOST_CHECK_EQUAL (zero_tree.find (3), 1);
+  BOOST_CHECK_EQUAL (zero_tree.find (6), 2);
+  BOOST_CHECK_EQUAL (zero_tree.find (9), 4);
+  BOOST_CHECK_EQUAL (zero_tree.find (14), 4);
+  BOOST_CHECK_EQUAL (zero_tree.find (14.5), 9);
+  BOOST_CHECK_EQUAL (zero_tree.find (15), 9);
+}
+
+double cumulative (int index)
+{
+  // cum: r0 : 2, r1 : 5, r2 : 8, r4 : 14
+  switch (index)
+    {
+    case 0: return 2.0/14;
+    case 1: return 5.0/14;
+    case 2: return 8.0/14;
+    case 3: return 8.0/14;
+    case 4: return 1;
+    }
+  return -1;
+}
+
+BOOST_AUTO_TEST_CASE (random_index_tenThousandDraws_statisticsAreCorrect)
+{
+  zero_tree.set_rate (0, 2); zero_tree.set_rate (1, 3);
+  zero_tree.set_rate (2, 3); zero_tree.set_rate (4, 6);
+  zero_tree.update_cumulates();
+  ExperimentalCumulative <int> ecf;
+  for (int i = 0; i < 10000; ++i) { ecf.add_pick (zero_tree.random_index()); }
+  BOOST_CHECK_EQUAL (ecf(2), ecf(3));
+  BOOST_CHECK_SMALL (distance_to_discrete_cumulative (ecf, cumulative), 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE (LargeTrees)
+
+BOOST_AUTO_TEST_CASE (find_severalLevels_returnsAppropriateIndex)
+{
+  KaryRateTree tree (1000);
+  for (int i = 0; i < 1000; ++i) { tree.set_rate (i, 1); }
+  tree.update_cumulates();
+  BOOST_CHECK_CLOSE (tree.total_rate(), 1000, 1e-13);
+  BOOST_CHECK_EQUAL (tree.find (0.5), 0);
+  BOOST_CHECK_EQUAL (tree.find (64.5), 64);
+  BOOST_CHECK_EQUAL (tree.find (517.5), 517);
+  BOOST_CHECK_EQUAL (tree.find (1000), 999);
+  tree.set_rate (517, 0); tree.update_cumulates();
+  BOOST_CHECK_CLOSE (tree.total_rate(), 999, 1e-13);
+  BOOST_CHECK_EQUAL (tree.find (517.5), 518);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
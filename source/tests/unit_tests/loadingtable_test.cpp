@@ -0,0 +1,105 @@
+/**
+ * @file loadingtable_test.cpp
+ * @brief Unit testing for LoadingTable class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE LoadingTable
+#include <boost/test/unit_test.hpp>
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "loadingtable.h"
+#include "chemicalsequence.h"
+#include "freechemical.h"
+#include "boundchemical.h"
+
+class CodonTable
+{
+public:
+  CodonTable (void)
+    : table (templates(), chemicals(), states(), rates())
+  {
+  }
+
+  FreeChemical aa_1, aa_2;
+  BoundChemical occupied_1, occupied_2;
+  LoadingTable table;
+
+private:
+  std::vector <std::string> templates (void)
+  {
+    std::vector <std::string> result;
+    result.push_back ("ABC"); result.push_back ("CCA");
+    return result;
+  }
+
+  std::vector <FreeChemical*> chemicals (void)
+  {
+    std::vector <FreeChemical*> result;
+    result.push_back (&aa_1); result.push_back (&aa_2);
+    return result;
+  }
+
+  std::vector <BoundChemical*> states (void)
+  {
+    std::vector <BoundChemical*> result;
+    result.push_back (&occupied_1); result.push_back (&occupied_2);
+    return result;
+  }
+
+  std::vector <double> rates (void) { return std::vector <double> (2, 1); }
+};
+
+BOOST_FIXTURE_TEST_SUITE (TemplateIndexTests, CodonTable)
+
+BOOST_AUTO_TEST_CASE (template_index_sequencePosition_matchesStringLookup)
+{
+  ChemicalSequence sequence ("ABCCABCCAX");
+  table.index_sequence (sequence);
+  const std::string& letters = sequence.sequence();
+  for (int i = 0; i <= letters.size(); ++i)
+    {
+      BOOST_CHECK_EQUAL (table.template_index (sequence, i),
+			 table.template_index (letters.substr (i, 3)));
+    }
+  BOOST_CHECK_EQUAL (table.template_index (sequence, 0), 0);
+  BOOST_CHECK_EQUAL (table.template_index (sequence, 2), 1);
+  BOOST_CHECK_EQUAL (table.template_index (sequence, 9),
+		     LoadingTable::UNKNOWN_TEMPLATE);
+}
+
+BOOST_AUTO_TEST_CASE (template_index_severalSequences_keptApart)
+{
+  ChemicalSequence first ("ABCA");
+  ChemicalSequence second ("CCAB");
+  table.index_sequence (first);
+  table.index_sequence (second);
+  table.index_sequence (first);
+  BOOST_CHECK_EQUAL (table.template_index (first, 0), 0);
+  BOOST_CHECK_EQUAL (table.template_index (second, 0), 1);
+  BOOST_CHECK_EQUAL (table.template_index (first, 0), 0);
+  BOOST_CHECK_EQUAL (table.template_index (second, 1),
+		     LoadingTable::UNKNOWN_TEMPLATE);
+}
+
+BOOST_AUTO_TEST_CASE (template_index_positionPastSequenceEnd_returnsUnknown)
+{
+  ChemicalSequence sequence ("ABCA");
+  table.index_sequence (sequence);
+  BOOST_CHECK_EQUAL (table.template_index (sequence, 5),
+		     LoadingTable::UNKNOWN_TEMPLATE);
+  BOOST_CHECK_EQUAL (table.template_index (sequence, 100),
+		     LoadingTable::UNKNOWN_TEMPLATE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -153,6 +153,27 @@ BOOST_AUTO_TEST_CASE (segments_twoJoiningSegments_returnsSegmentBounds)
   BOOST_CHECK_EQUAL (result[0], 4);
   BOOST_CHECK_EQUAL (result[1], 7);
 }
- 
+
+BOOST_AUTO_TEST_CASE (segments_gapFilled_segmentsMerged)
+{
+  extend_segment (1, 4); extend_segment (5, 8);
+  empty_strand.occupy (4);
+  std::vector <int> result = empty_strand.segments();
+  BOOST_CHECK_EQUAL (result.size(), 2);
+  BOOST_CHECK_EQUAL (result[0], 1);
+  BOOST_CHECK_EQUAL (result[1], 7);
+  BOOST_CHECK_EQUAL (empty_strand.occupied (0), false);
+  BOOST_CHECK_EQUAL (empty_strand.occupied (8), false);
+}
+
+BOOST_AUTO_TEST_CASE (reset_completedStrand_strandEmpty)
+{
+  extend_segment (0, 10);
+  empty_strand.reset();
+  BOOST_CHECK_EQUAL (empty_strand.empty(), true);
+  BOOST_CHECK_EQUAL (empty_strand.occupied (3), false);
+  BOOST_CHECK_EQUAL (empty_strand.segments().size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
  
@@ -124,5 +124,23 @@ BOOST_AUTO_TEST_CASE (draw_exponential_tenThousandDrawsLambdaZeroOne_statisticsC
 		     0.01);
 }
 
+double cumulative_erlang (double x, int k, double lambda)
+{
+  double term = 1, sum = 0;
+  for (int n = 0; n < k; ++n) { sum += term; term *= lambda*x / (n+1); }
+  return 1 - exp (-lambda*x) * sum;
+}
+double cumulative_erlang_5_2 (double x) { return cumulative_erlang (x, 5, 2);}
+
+BOOST_AUTO_TEST_CASE (draw_erlang_tenThousandDrawsShapeFiveLambdaTwo_statisticsCheckOut)
+{
+  ExperimentalCumulative<double> erlang;
+  for (int i = 0; i < 10000; ++i)
+    { erlang.add_pick (RandomHandler::instance().draw_erlang (5, 2)); }
+  BOOST_CHECK_SMALL (distance_to_continuous_cumulative (erlang, 
+							cumulative_erlang_5_2),
+		     0.02);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+
+
+/**
+ * @file rangemaxtree_test.cpp
+ * @brief Unit testing for RangeMaxTree class.
+ *
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE RangeMaxTree
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib> // std::rand std::srand
+#include <vector> // std::vector
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "rangemaxtree.h"
+
+BOOST_AUTO_TEST_CASE (constructor_newTree_valuesAreZero)
+{
+  RangeMaxTree tree (10);
+  BOOST_CHECK_EQUAL (tree.size(), 10);
+  for (int i = 0; i < 10; ++i) { BOOST_CHECK_EQUAL (tree [i], 0); }
+  BOOST_CHECK_EQUAL (tree.max (0, 9), 0);
+}
+
+BOOST_AUTO_TEST_CASE (add_rangeIncremented_onlyRangeChanges)
+{
+  RangeMaxTree tree (10);
+  tree.add (2, 5, 3);
+  for (int i = 0; i < 10; ++i)
+    { BOOST_CHECK_EQUAL (tree [i], ((i >= 2) && (i <= 5)) ? 3 : 0); }
+}
+
+BOOST_AUTO_TEST_CASE (max_overlappingAdds_returnsLargestValueInRange)
+{
+  RangeMaxTree tree (13);
+  tree.add (0, 6, 1);
+  tree.add (4, 12, 2);
+  tree.add (8, 8, -5);
+  BOOST_CHECK_EQUAL (tree.max (0, 3), 1);
+  BOOST_CHECK_EQUAL (tree.max (3, 4), 3);
+  BOOST_CHECK_EQUAL (tree.max (7, 12), 2);
+  BOOST_CHECK_EQUAL (tree.max (8, 8), -3);
+}
+
+BOOST_AUTO_TEST_CASE (max_randomAdds_matchesDirectScan)
+{
+  std::srand (1);
+  for (int size = 1; size < 40; ++size)
+    {
+      RangeMaxTree tree (size);
+      std::vector <int> values (size, 0);
+      for (int n = 0; n < 500; ++n)
+	{
+	  int first = std::rand() % size;
+	  int last = first + std::rand() % (size - first);
+	  if (n % 2 == 0)
+	    {
+	      int value = std::rand() % 7 - 3;
+	      tree.add (first, last, value);
+	      for (int i = first; i <= last; ++i) { values [i] += value; }
+	    }
+	  else
+	    {
+	      int expected = values [first];
+	      for (int i = first+1; i <= last; ++i)
+		{ if (values [i] > expected) { expected = values [i]; } }
+	      BOOST_CHECK_EQUAL (tree.max (first, last), expected);
+	    }
+	}
+    }
+}
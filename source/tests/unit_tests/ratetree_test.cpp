@@ -94,3 +94,68 @@ BOOST_AUTO_TEST_CASE (random_index_tenThousandDraws_statisticsAreCorrect)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE (FrequencyShapedTrees)
+
+BOOST_AUTO_TEST_CASE (reshape_afterEnoughDraws_frequentRateIsCloseToRoot)
+{
+  RateTree tree (100, 1000);
+  for (int i = 0; i < 100; ++i) { tree.set_rate (i, 1); }
+  tree.set_rate (57, 1000);
+  tree.update_cumulates();
+  BOOST_CHECK (tree.depth (57) > 5);
+
+  for (int i = 0; i < 999; ++i) { tree.random_index(); }
+  tree.reshape();
+  BOOST_CHECK (tree.depth (57) > 5);
+  tree.random_index();
+  tree.update_cumulates();
+  BOOST_CHECK (tree.depth (57) > 5);
+  tree.reshape();
+  BOOST_CHECK_EQUAL (tree.depth (57), 1);
+  BOOST_CHECK_CLOSE (tree.total_rate(), 1099, 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE (random_index_afterRebuild_statisticsAreCorrect)
+{
+  RateTree tree (10, 100);
+  tree.set_rate (0, 2); tree.set_rate (1, 3);
+  tree.set_rate (2, 3); tree.set_rate (4, 6);
+  tree.update_cumulates();
+  for (int i = 0; i < 100; ++i) { tree.random_index(); }
+  tree.reshape();
+  tree.set_rate (1, 1); tree.update_cumulates();
+  tree.set_rate (1, 3); tree.update_cumulates();
+
+  ExperimentalCumulative <int> ecf;
+  for (int i = 0; i < 10000; ++i) { ecf.add_pick (tree.random_index()); }
+  BOOST_CHECK_EQUAL (ecf(2), ecf(3));
+  BOOST_CHECK_SMALL
+    (distance_to_discrete_cumulative (ecf, BaseTests::cumulative), 0.01);
+}
+
+BOOST_AUTO_TEST_CASE (update_cumulates_allRatesSetAfterReshape_totalIsSumOfRates)
+{
+  // exponential rates yield a maximally unbalanced tree
+  RateTree tree (20, 1000);
+  for (int i = 0; i < 20; ++i) { tree.set_rate (i, 1 << i); }
+  tree.update_cumulates();
+  for (int j = 0; j < 5; ++j)
+    {
+      for (int i = 0; i < 1000; ++i) { tree.random_index(); }
+      tree.update_cumulates();
+      tree.reshape();
+    }
+  BOOST_CHECK (tree.depth (19) < tree.depth (0));
+
+  for (int i = 0; i < 20; ++i) { tree.set_rate (i, i+1); }
+  tree.update_cumulates();
+  BOOST_CHECK_CLOSE (tree.total_rate(), 210, 1e-13);
+  for (int i = 0; i < 20; ++i) { tree.set_rate (i, 0); }
+  tree.set_rate (3, 2);
+  tree.update_cumulates();
+  BOOST_CHECK_EQUAL (tree.total_rate(), 2);
+  BOOST_CHECK_EQUAL (tree.random_index(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+
+
+/**
+ * @file siteblock_test.cpp
+ * @brief Unit testing for SiteBlock class.
+ *
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SiteBlock
+#include <boost/test/unit_test.hpp>
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "siteblock.h"
+
+class ThreeSites
+{
+public:
+  ThreeSites (void)
+  {
+    // site 10 is free, site 11 occupied once, site 12 fully occupied
+    block.add_site (10, 1, 2);
+    block.add_site (11, 2, 1);
+    block.add_site (12, 4, 0);
+  }
+
+  SiteBlock block;
+};
+
+BOOST_FIXTURE_TEST_SUITE (Rates, ThreeSites)
+
+BOOST_AUTO_TEST_CASE (total_rate_threeSites_sumsAvailableSites)
+{
+  BOOST_CHECK_CLOSE (block.total_rate(), 1*2 + 2*1, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE (shift_levels_sequenceAdded_allSitesShifted)
+{
+  block.shift_levels (1);
+  BOOST_CHECK_CLOSE (block.total_rate(), 1*3 + 2*2 + 4*1, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE (shift_levels_sequencesRemoved_levelsClampedAtZero)
+{
+  block.shift_levels (-2);
+  BOOST_CHECK_EQUAL (block.total_rate(), 0);
+  block.shift_levels (1);
+  BOOST_CHECK_CLOSE (block.total_rate(), 1, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE (set_level_afterShift_levelTakenAsCurrent)
+{
+  block.shift_levels (1);
+  block.set_level (2, 0);
+  BOOST_CHECK_CLOSE (block.total_rate(), 1*3 + 2*2, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE (random_site_afterShift_drawsOnlyAvailableSites)
+{
+  block.shift_levels (-1);
+  for (int i = 0; i < 20; ++i) { BOOST_CHECK_EQUAL (block.random_site(), 10); }
+  block.shift_levels (1);
+  block.set_level (0, 0);
+  for (int i = 0; i < 20; ++i) { BOOST_CHECK_EQUAL (block.random_site(), 11); }
+}
+
+BOOST_AUTO_TEST_CASE (add_site_afterDrawing_newSiteDrawable)
+{
+  block.set_level (1, 0);
+  BOOST_CHECK_EQUAL (block.random_site(), 10);
+  block.set_level (0, 0);
+  block.add_site (13, 1, 1);
+  for (int i = 0; i < 20; ++i) { BOOST_CHECK_EQUAL (block.random_site(), 13); }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -19,6 +19,7 @@ class MockBindingSite : public BindingSite
     , _updated (false) {}
   bool was_updated (void) { return _updated; }
   void update (void) { _updated = true; }
+  void update_population (int) { _updated = true; }
   void reset_update (void) { _updated = false; }
 
  private:
@@ -0,0 +1,123 @@
+/**
+ * @file sortingratevector_test.cpp
+ * @brief Unit testing for SortingRateVector class.
+ * 
+ * @authors Marc Dinh, Stephan Fischer
+ */
+
+
+// ==================
+//  General Includes
+// ==================
+//
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SortingRateVector
+#include <boost/test/unit_test.hpp>
+
+// ==================
+//  Project Includes
+// ==================
+//
+#include "sortingratevector.h"
+#include "experimentalcumulative.h"
+
+
+class VectorSize10
+{
+public:
+  VectorSize10 (void)
+    : zero_vector (10)
+  {}
+
+  SortingRateVector zero_vector;
+};
+
+BOOST_FIXTURE_TEST_SUITE (BaseTests, VectorSize10)
+ 
+BOOST_AUTO_TEST_CASE (total_rate_zeroVector_returnsZero)
+{
+  BOOST_CHECK_SMALL (zero_vector.total_rate(), 1e-15);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_rateModifiedTwice_returnsLastRate)
+{
+  zero_vector.set_rate (9, 2); zero_vector.update_cumulates();
+  zero_vector.set_rate (9, 5); zero_vector.set_rate (0, 1);
+  zero_vector.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_vector.total_rate(), 6, 1e-13);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_ratesSetBackToZero_returnsExactlyZero)
+{
+  zero_vector.set_rate (3, 0.1); zero_vector.set_rate (7, 0.2);
+  zero_vector.update_cumulates();
+  zero_vector.set_rate (3, 0); zero_vector.set_rate (7, 0);
+  zero_vector.update_cumulates();
+  BOOST_CHECK_EQUAL (zero_vector.total_rate(), 0);
+}
+
+BOOST_AUTO_TEST_CASE (total_rate_largeRateCancelled_returnsRemainingRate)
+{
+  zero_vector.set_rate (3, 1); zero_vector.set_rate (7, 1e20);
+  zero_vector.update_cumulates();
+  zero_vector.set_rate (7, 0);
+  zero_vector.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_vector.total_rate(), 1, 1e-13);
+  BOOST_CHECK_EQUAL (zero_vector.random_index(), 3);
+}
+
+BOOST_AUTO_TEST_CASE (find_MultipleRates_returnsAppropriateIndex)
+{
+  zero_vector.set_rate (0, 2); zero_vector.set_rate (1, 3);
+  zero_vector.set_rate (2, 3); zero_vector.set_rate (4, 6);
+  zero_vector.set_rate (9, 1);
+  zero_vector.update_cumulates();
+  BOOST_CHECK_EQUAL (zero_vector.find (1), 0);
+  BOOST_CHECK_EQUAL (zero_vector.find (2), 0);
+  BOOST_CHECK_EQUAL (zero_vector.find (3), 1);
+  BOOST_CHECK_EQUAL (zero_vector.find (6), 2);
+  BOOST_CHECK_EQUAL (zero_vector.find (9), 4);
+  BOOST_CHECK_EQUAL (zero_vector.find (14.5), 9);
+  BOOST_CHECK_EQUAL (zero_vector.find (15), 9);
+}
+
+BOOST_AUTO_TEST_CASE (random_index_frequentRate_movesToFront)
+{
+  zero_vector.set_rate (9, 1); zero_vector.update_cumulates();
+  for (int i = 0; i < 9; ++i) { BOOST_CHECK_EQUAL (zero_vector.random_index(), 9); }
+  BOOST_CHECK_EQUAL (zero_vector.position (9), 0);
+  BOOST_CHECK_EQUAL (zero_vector.position (0), 1);
+
+  // rates are still modified at the right place
+  zero_vector.set_rate (0, 3); zero_vector.update_cumulates();
+  BOOST_CHECK_CLOSE (zero_vector.total_rate(), 4, 1e-13);
+  BOOST_CHECK_EQUAL (zero_vector.find (0.5), 9);
+  BOOST_CHECK_EQUAL (zero_vector.find (1.5), 0);
+}
+
+double cumulative (int index)
+{
+  // cum: r0 : 2, r1 : 5, r2 : 8, r4 : 14
+  switch (index)
+    {
+    case 0: return 2.0/14;
+    case 1: return 5.0/14;
+    case 2: return 8.0/14;
+    case 3: return 8.0/14;
+    case 4: return 1;
+    }
+  return -1;
+}
+
+BOOST_AUTO_TEST_CASE (random_index_tenThousandDraws_statisticsAreCorrect)
+{
+  zero_vector.set_rate (0, 2); zero_vector.set_rate (1, 3);
+  zero_vector.set_rate (2, 3); zero_vector.set_rate (4, 6);
+  zero_vector.update_cumulates();
+  ExperimentalCumulative <int> ecf;
+  for (int i = 0; i < 10000; ++i) { ecf.add_pick (zero_vector.random_index()); }
+  BOOST_CHECK_EQUAL (ecf(2), ecf(3));
+  BOOST_CHECK_SMALL (distance_to_discrete_cumulative (ecf, cumulative), 0.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END()